@@ -0,0 +1,99 @@
+// An AVX2 float sum over s21::aligned_vector against the same kernel over
+// storage without those guarantees. The padded kernel reads 64 bytes per
+// step with aligned loads and runs over padded_size(), the padding adds
+// zeros, so it has no scalar epilogue. The others use unaligned loads and
+// finish the last elements one by one: on an aligned_vector, on one shifted
+// by a float so that every step straddles two cache lines, and on
+// s21::Vector, which is only as aligned as operator new makes it. The sizes
+// are not multiples of 16 so the epilogue always runs.
+//
+// The kernels carry a target attribute instead of needing -mavx2, and the
+// benchmarks skip themselves on a CPU without AVX2.
+
+#include <cstddef>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+namespace {
+
+enum class Storage { kPadded, kAligned, kShifted, kVector };
+
+__attribute__((target("avx2"))) float horizontal_sum(__m256 v) {
+  __m128 half = _mm_add_ps(_mm256_castps256_ps128(v),
+                           _mm256_extractf128_ps(v, 1));
+  half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+  half = _mm_add_ss(half, _mm_movehdup_ps(half));
+  return _mm_cvtss_f32(half);
+}
+
+__attribute__((target("avx2"))) float sum_padded(const float *data,
+                                                 std::size_t padded) {
+  __m256 lo = _mm256_setzero_ps();
+  __m256 hi = _mm256_setzero_ps();
+  for (std::size_t i = 0; i < padded; i += 16) {
+    lo = _mm256_add_ps(lo, _mm256_load_ps(data + i));
+    hi = _mm256_add_ps(hi, _mm256_load_ps(data + i + 8));
+  }
+  return horizontal_sum(_mm256_add_ps(lo, hi));
+}
+
+__attribute__((target("avx2"))) float sum_unaligned(const float *data,
+                                                    std::size_t n) {
+  __m256 lo = _mm256_setzero_ps();
+  __m256 hi = _mm256_setzero_ps();
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    lo = _mm256_add_ps(lo, _mm256_loadu_ps(data + i));
+    hi = _mm256_add_ps(hi, _mm256_loadu_ps(data + i + 8));
+  }
+  float sum = horizontal_sum(_mm256_add_ps(lo, hi));
+  for (; i < n; ++i) sum += data[i];
+  return sum;
+}
+
+template <Storage S>
+void BM_Sum(benchmark::State &state) {
+  if (!__builtin_cpu_supports("avx2")) {
+    state.SkipWithError("the CPU has no AVX2");
+    return;
+  }
+  std::size_t n = state.range(0);
+  s21::aligned_vector<float> aligned(n + 1);
+  s21::Vector<float> vector(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    aligned[i + (S == Storage::kShifted)] = i % 7;
+    vector[i] = i % 7;
+  }
+  for (auto _ : state) {
+    float sum;
+    if constexpr (S == Storage::kPadded) {
+      sum = sum_padded(aligned.data(), aligned.padded_size());
+    } else if constexpr (S == Storage::kAligned) {
+      sum = sum_unaligned(aligned.data(), n);
+    } else if constexpr (S == Storage::kShifted) {
+      sum = sum_unaligned(aligned.data() + 1, n);
+    } else {
+      sum = sum_unaligned(&vector[0], n);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+void reduce_sizes(benchmark::internal::Benchmark *b) {
+  for (int n : {13, 1021, 16381, 262139}) b->Arg(n);
+}
+
+BENCHMARK_TEMPLATE(BM_Sum, Storage::kPadded)->Apply(reduce_sizes);
+BENCHMARK_TEMPLATE(BM_Sum, Storage::kAligned)->Apply(reduce_sizes);
+BENCHMARK_TEMPLATE(BM_Sum, Storage::kShifted)->Apply(reduce_sizes);
+BENCHMARK_TEMPLATE(BM_Sum, Storage::kVector)->Apply(reduce_sizes);
+
+}  // namespace
+#endif
+
+BENCHMARK_MAIN();
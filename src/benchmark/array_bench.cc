@@ -0,0 +1,53 @@
+// Copy and swap cost of s21::Array against std::array, for arrays of 16,
+// 256 and 4096 int64. With T trivially copyable both are trivially copyable
+// themselves, so a copy should come down to one memcpy.
+
+#include <array>
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+template <typename Array>
+void BM_Copy(benchmark::State &state) {
+  Array source{};
+  for (std::size_t i = 0; i < source.size(); ++i) source[i] = i;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(source);
+    Array copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Array));
+}
+
+template <typename Array>
+void BM_Swap(benchmark::State &state) {
+  Array a{}, b{};
+  for (std::size_t i = 0; i < a.size(); ++i) a[i] = i;
+  benchmark::DoNotOptimize(a.data());
+  benchmark::DoNotOptimize(b.data());
+  for (auto _ : state) {
+    a.swap(b);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(Array));
+}
+
+BENCHMARK_TEMPLATE(BM_Copy, s21::Array<std::int64_t, 16>);
+BENCHMARK_TEMPLATE(BM_Copy, std::array<std::int64_t, 16>);
+BENCHMARK_TEMPLATE(BM_Copy, s21::Array<std::int64_t, 256>);
+BENCHMARK_TEMPLATE(BM_Copy, std::array<std::int64_t, 256>);
+BENCHMARK_TEMPLATE(BM_Copy, s21::Array<std::int64_t, 4096>);
+BENCHMARK_TEMPLATE(BM_Copy, std::array<std::int64_t, 4096>);
+BENCHMARK_TEMPLATE(BM_Swap, s21::Array<std::int64_t, 16>);
+BENCHMARK_TEMPLATE(BM_Swap, std::array<std::int64_t, 16>);
+BENCHMARK_TEMPLATE(BM_Swap, s21::Array<std::int64_t, 256>);
+BENCHMARK_TEMPLATE(BM_Swap, std::array<std::int64_t, 256>);
+BENCHMARK_TEMPLATE(BM_Swap, s21::Array<std::int64_t, 4096>);
+BENCHMARK_TEMPLATE(BM_Swap, std::array<std::int64_t, 4096>);
+
+}  // namespace
+
+BENCHMARK_MAIN();
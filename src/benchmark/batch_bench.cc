@@ -0,0 +1,83 @@
+// Batched lookups against one find per key, on maps up to larger than the
+// last level cache, where every level of a lookup is a likely cache miss.
+
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::size_t kBatch = 4096;
+
+using Map = s21::map<std::int64_t, std::int64_t>;
+
+// Half of the probes hit, the odd keys, and half miss.
+std::vector<std::int64_t> probes(std::size_t n) {
+  std::vector<std::int64_t> keys = s21_bench::shuffled_keys(kBatch, 7);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+    keys[i] = (keys[i] * 7919) % static_cast<std::int64_t>(n * 2);
+  return keys;
+}
+
+void fill(Map &map, std::size_t n) {
+  for (auto key : s21_bench::shuffled_keys(n)) map.insert(key, key);
+}
+
+void BM_FindSequential(benchmark::State &state) {
+  Map map;
+  fill(map, state.range(0));
+  auto keys = probes(state.range(0));
+  std::vector<Map::iterator> found(keys.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < keys.size(); ++i) found[i] = map.find(keys[i]);
+    benchmark::DoNotOptimize(found.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_FindBatch(benchmark::State &state) {
+  Map map;
+  fill(map, state.range(0));
+  auto keys = probes(state.range(0));
+  std::vector<Map::iterator> found(keys.size());
+  for (auto _ : state) {
+    map.find_batch(keys, found.begin());
+    benchmark::DoNotOptimize(found.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_ContainsSequential(benchmark::State &state) {
+  Map map;
+  fill(map, state.range(0));
+  auto keys = probes(state.range(0));
+  std::vector<char> present(keys.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < keys.size(); ++i)
+      present[i] = map.contains(keys[i]);
+    benchmark::DoNotOptimize(present.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_ContainsBatch(benchmark::State &state) {
+  Map map;
+  fill(map, state.range(0));
+  auto keys = probes(state.range(0));
+  std::vector<char> present(keys.size());
+  for (auto _ : state) {
+    map.contains_batch(keys, present.begin());
+    benchmark::DoNotOptimize(present.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK(BM_FindSequential)->Apply(s21_bench::sizes);
+BENCHMARK(BM_FindBatch)->Apply(s21_bench::sizes);
+BENCHMARK(BM_ContainsSequential)->Apply(s21_bench::sizes);
+BENCHMARK(BM_ContainsBatch)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+// Throughput of one producer and one consumer thread against batch size.
+// blocking_queue moves each batch with push_bulk and drain under a single
+// lock; the baseline is the per-element pattern it replaces, an s21::Queue
+// behind a mutex where the consumer locks once for front() and once for
+// pop(). state.range(0) is the batch size.
+
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::size_t kCapacity = 4096;
+constexpr std::int64_t kMessages = 1 << 18;
+
+void BM_BlockingQueue(benchmark::State &state) {
+  const auto batch_size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    s21::blocking_queue<std::int64_t> queue{kCapacity};
+    std::thread producer([&queue, batch_size] {
+      std::vector<std::int64_t> batch;
+      for (std::int64_t i = 0; i < kMessages; ++i) {
+        batch.push_back(i);
+        if (batch.size() == batch_size) {
+          queue.push_bulk(batch.begin(), batch.end());
+          batch.clear();
+        }
+      }
+      queue.push_bulk(batch.begin(), batch.end());
+      queue.close();
+    });
+    std::vector<std::int64_t> batch;
+    std::int64_t sum = 0;
+    while (queue.drain(std::back_inserter(batch), batch_size)) {
+      for (std::int64_t value : batch) sum += value;
+      batch.clear();
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kMessages);
+}
+
+void BM_LockedQueue(benchmark::State &state) {
+  for (auto _ : state) {
+    std::mutex mutex;
+    s21::Queue<std::int64_t> queue;
+    std::thread producer([&] {
+      for (std::int64_t i = 0; i < kMessages; ++i) {
+        for (;;) {
+          {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (queue.size() < kCapacity) break;
+          }
+          std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        queue.push(i);
+      }
+    });
+    std::int64_t sum = 0;
+    for (std::int64_t received = 0; received < kMessages;) {
+      std::int64_t value;
+      {
+        std::unique_lock<std::mutex> lock{mutex};
+        if (queue.empty()) {
+          lock.unlock();
+          std::this_thread::yield();
+          continue;
+        }
+        value = queue.front();
+      }
+      std::lock_guard<std::mutex> lock{mutex};
+      queue.pop();
+      sum += value;
+      ++received;
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kMessages);
+}
+
+BENCHMARK(BM_BlockingQueue)
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LockedQueue)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+// set::contains with and without the blocked Bloom filter policy on a probe
+// stream where 96% of the keys are missing, plus what the filter costs on
+// insert.
+
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+using Key = std::uint64_t;
+using PlainSet = s21::set<Key>;
+using BloomSet = s21::set<Key, s21::BloomFilter<Key>>;
+
+template <typename Set>
+Set make_set(const std::vector<std::int64_t> &keys) {
+  Set set;
+  for (auto key : keys) set.insert(key);
+  return set;
+}
+
+template <typename Set>
+void report_filter(benchmark::State &, const Set &) {}
+
+template <>
+void report_filter(benchmark::State &state, const BloomSet &set) {
+  state.counters["fpr"] = set.filter().false_positive_rate();
+  state.counters["filter_bytes"] = set.filter().memory_usage();
+}
+
+// Every 25th probe is a hit, the odd keys, the others are even misses.
+template <typename Set>
+void BM_ContainsMissHeavy(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set = make_set<Set>(keys);
+  std::vector<Key> probes(keys.begin(), keys.end());
+  for (std::size_t i = 0; i < probes.size(); ++i)
+    if (i % 25) --probes[i];
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.contains(probes[i]));
+    if (++i == probes.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+  report_filter(state, set);
+}
+
+template <typename Set>
+void BM_Insert(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Set set = make_set<Set>(keys);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+BENCHMARK_TEMPLATE(BM_ContainsMissHeavy, PlainSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_ContainsMissHeavy, BloomSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Insert, PlainSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Insert, BloomSet)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
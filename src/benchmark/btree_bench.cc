@@ -0,0 +1,109 @@
+// B-tree containers against the AvlTree based ones.
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+template <typename Set>
+void BM_SetLookup(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set;
+  for (auto key : keys) set.insert(key);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.contains(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set>
+void BM_SetInsert(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Set set;
+    for (auto key : keys) set.insert(key);
+    benchmark::DoNotOptimize(set.size());
+    state.PauseTiming();
+    set.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Set>
+void BM_SetErase(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Set set;
+    for (auto key : keys) set.insert(key);
+    state.ResumeTiming();
+    for (auto key : keys) set.erase(set.find(key));
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Set>
+void BM_SetIterate(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set;
+  for (auto key : keys) set.insert(key);
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (auto it = set.begin(); it != set.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Map>
+void BM_MapLookup(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Map map;
+  for (auto key : keys) map.insert(key, key);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.at(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_MapInsert(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Map map;
+    for (auto key : keys) map.insert(key, key);
+    benchmark::DoNotOptimize(map.size());
+    state.PauseTiming();
+    map.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+using AvlSet = s21::set<std::int64_t>;
+using BTreeSet = s21::btree_set<std::int64_t>;
+using AvlMap = s21::map<std::int64_t, std::int64_t>;
+using BTreeMap = s21::btree_map<std::int64_t, std::int64_t>;
+
+BENCHMARK_TEMPLATE(BM_SetLookup, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetLookup, BTreeSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetInsert, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetInsert, BTreeSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetErase, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetErase, BTreeSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetIterate, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetIterate, BTreeSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookup, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookup, BTreeMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapInsert, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapInsert, BTreeMap)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
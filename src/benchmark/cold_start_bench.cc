@@ -0,0 +1,109 @@
+// Time from a snapshot on disk to the answers of the first lookups: reading
+// serialized pairs back into a map against opening the sorted table that
+// map::dump_sorted wrote with mapped_table. The page cache is emptied of the
+// file before every iteration, the lookups hit random keys.
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+struct Record {
+  std::uint64_t id, a, b, c;
+};
+
+using Map = s21::map<std::uint64_t, Record>;
+
+constexpr int kLookups = 1000;
+
+std::string snapshot_path(const char *kind, std::int64_t n) {
+  return "/tmp/s21_cold_" + std::string{kind} + "_" + std::to_string(n);
+}
+
+Map make_map(std::int64_t n) {
+  Map map;
+  for (auto key : s21_bench::shuffled_keys(n))
+    map.insert(key, Record{static_cast<std::uint64_t>(key), 1, 2, 3});
+  return map;
+}
+
+// The per element serialization the table replaces: key and record back to
+// back, in key order.
+void write_pairs(Map &map, const std::string &path) {
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    std::fwrite(&(*it).first, sizeof(std::uint64_t), 1, file);
+    std::fwrite(&(*it).second, sizeof(Record), 1, file);
+  }
+  std::fclose(file);
+}
+
+void evict(const std::string &path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  ::close(fd);
+}
+
+void BM_RebuildMap(benchmark::State &state) {
+  std::string path = snapshot_path("pairs", state.range(0));
+  Map source = make_map(state.range(0));
+  write_pairs(source, path);
+  auto probes = s21_bench::shuffled_keys(state.range(0), 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    evict(path);
+    state.ResumeTiming();
+    Map map;
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    std::uint64_t key;
+    Record record;
+    while (std::fread(&key, sizeof(key), 1, file) &&
+           std::fread(&record, sizeof(record), 1, file))
+      map.insert(key, record);
+    std::fclose(file);
+    std::uint64_t sum{};
+    for (int i = 0; i < kLookups; ++i)
+      sum += map.at(probes[i % probes.size()]).id;
+    benchmark::DoNotOptimize(sum);
+    state.PauseTiming();
+    map.clear();
+    state.ResumeTiming();
+  }
+  std::remove(path.c_str());
+}
+
+void BM_OpenMappedTable(benchmark::State &state) {
+  std::string path = snapshot_path("table", state.range(0));
+  Map source = make_map(state.range(0));
+  source.dump_sorted(path);
+  auto probes = s21_bench::shuffled_keys(state.range(0), 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    evict(path);
+    state.ResumeTiming();
+    s21::mapped_table<std::uint64_t, Record> table{path};
+    std::uint64_t sum{};
+    for (int i = 0; i < kLookups; ++i)
+      sum += table.at(probes[i % probes.size()]).id;
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(path.c_str());
+}
+
+BENCHMARK(BM_RebuildMap)
+    ->Apply(s21_bench::sizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OpenMappedTable)
+    ->Apply(s21_bench::sizes)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+// Sharded concurrent_map against an s21::map behind one global mutex, from 1
+// to 64 threads and for several shares of reads.
+
+#include <mutex>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::size_t kKeys = 100000;
+
+// the baseline the sharded map replaces
+class LockedMap {
+ public:
+  bool insert_or_assign(std::int64_t key, std::int64_t obj) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return map_.insert_or_assign(key, obj).second;
+  }
+
+  bool contains(std::int64_t key) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return map_.contains(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<std::int64_t, std::int64_t> map_;
+};
+
+using ConcurrentMap = s21::concurrent_map<std::int64_t, std::int64_t>;
+
+// Shared by all the threads of a run, filled once on first use.
+template <typename Map>
+Map &shared_map() {
+  static Map *map = [] {
+    Map *filled = new Map;
+    for (auto key : s21_bench::shuffled_keys(kKeys))
+      filled->insert_or_assign(key, key);
+    return filled;
+  }();
+  return *map;
+}
+
+// state.range(0) is the percentage of reads, the writes overwrite present
+// keys so the map keeps its size.
+template <typename Map>
+void BM_Mixed(benchmark::State &state) {
+  Map &map = shared_map<Map>();
+  auto keys = s21_bench::shuffled_keys(kKeys, state.thread_index() + 1);
+  std::int64_t reads = state.range(0);
+  std::size_t i{};
+  for (auto _ : state) {
+    if (static_cast<std::int64_t>(i % 100) < reads)
+      benchmark::DoNotOptimize(map.contains(keys[i]));
+    else
+      benchmark::DoNotOptimize(map.insert_or_assign(keys[i], i));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Mixed, LockedMap)
+    ->Arg(50)
+    ->Arg(90)
+    ->Arg(99)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mixed, ConcurrentMap)
+    ->Arg(50)
+    ->Arg(90)
+    ->Arg(99)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+// s21::deque against std::deque and the containers it replaces: push_front
+// on s21::Vector is an insert at begin() that shifts every element, and
+// indexing s21::list walks the nodes. The push-front benchmark builds a
+// sequence of n elements from the front, the index benchmark reads n
+// elements at random positions.
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+template <typename Deque>
+void push_front(Deque &d, std::int64_t value) {
+  d.push_front(value);
+}
+
+void push_front(s21::Vector<std::int64_t> &v, std::int64_t value) {
+  v.insert(v.begin(), value);
+}
+
+template <typename Container>
+void BM_PushFront(benchmark::State &state) {
+  for (auto _ : state) {
+    Container c;
+    for (std::int64_t i = 0; i < state.range(0); ++i) push_front(c, i);
+    benchmark::DoNotOptimize(c.front());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void BM_Index(benchmark::State &state) {
+  Container c;
+  for (std::int64_t i = 0; i < state.range(0); ++i) c.push_back(i);
+  std::vector<std::int64_t> positions =
+      s21_bench::shuffled_keys(state.range(0));
+  for (auto &position : positions) position /= 2;
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (std::int64_t position : positions) sum += c[position];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using S21Deque = s21::deque<std::int64_t>;
+using StdDeque = std::deque<std::int64_t>;
+using S21Vector = s21::Vector<std::int64_t>;
+
+BENCHMARK_TEMPLATE(BM_PushFront, S21Deque)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_PushFront, StdDeque)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_PushFront, S21Vector)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_Index, S21Deque)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Index, StdDeque)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Index, S21Vector)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,143 @@
+// Sorted-vector containers against the tree based ones: heap footprint and
+// lookup throughput.
+
+#include <cstdlib>
+#include <new>
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#define S21_USABLE_SIZE malloc_size
+#else
+#include <malloc.h>
+#define S21_USABLE_SIZE malloc_usable_size
+#endif
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+// Every heap block of the process is accounted with its real usable size, so
+// allocator rounding shows up in the footprint. Kept out of line so that the
+// compiler does not pair the inlined malloc/free with new/delete expressions.
+static std::size_t live_bytes = 0;
+
+__attribute__((noinline)) void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc{};
+  live_bytes += S21_USABLE_SIZE(ptr);
+  return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+  if (ptr) live_bytes -= S21_USABLE_SIZE(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+template <typename Set>
+void fill_set(Set &set, const std::vector<std::int64_t> &keys) {
+  for (auto key : keys) set.insert(key);
+}
+
+template <typename Key>
+void fill_set(s21::flat_set<Key> &set, const std::vector<std::int64_t> &keys) {
+  set.insert(keys.begin(), keys.end());
+  set.shrink_to_fit();
+}
+
+template <typename Map>
+void fill_map(Map &map, const std::vector<std::int64_t> &keys) {
+  for (auto key : keys) map.insert(key, key);
+}
+
+template <typename Key, typename T>
+void fill_map(s21::flat_map<Key, T> &map,
+              const std::vector<std::int64_t> &keys) {
+  std::vector<std::pair<Key, T>> items;
+  for (auto key : keys) items.emplace_back(key, key);
+  map.insert(items.begin(), items.end());
+  map.shrink_to_fit();
+}
+
+template <typename Set>
+void BM_SetFootprint(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    std::size_t before = live_bytes;
+    Set set;
+    fill_set(set, keys);
+    state.counters["bytes_per_elem"] =
+        static_cast<double>(live_bytes - before) / keys.size();
+  }
+}
+
+template <typename Map>
+void BM_MapFootprint(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    std::size_t before = live_bytes;
+    Map map;
+    fill_map(map, keys);
+    state.counters["bytes_per_elem"] =
+        static_cast<double>(live_bytes - before) / keys.size();
+  }
+}
+
+template <typename Set>
+void BM_SetLookup(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set;
+  fill_set(set, keys);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.contains(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_MapLookup(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Map map;
+  fill_map(map, keys);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.at(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using AvlSet = s21::set<std::int64_t>;
+using BTreeSet = s21::btree_set<std::int64_t>;
+using FlatSet = s21::flat_set<std::int64_t>;
+using AvlMap = s21::map<std::int64_t, std::int64_t>;
+using FlatMap = s21::flat_map<std::int64_t, std::int64_t>;
+
+BENCHMARK_TEMPLATE(BM_SetFootprint, AvlSet)
+    ->Apply(s21_bench::sizes)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_SetFootprint, BTreeSet)
+    ->Apply(s21_bench::sizes)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_SetFootprint, FlatSet)
+    ->Apply(s21_bench::sizes)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_MapFootprint, AvlMap)
+    ->Apply(s21_bench::sizes)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_MapFootprint, FlatMap)
+    ->Apply(s21_bench::sizes)
+    ->Iterations(1);
+
+BENCHMARK_TEMPLATE(BM_SetLookup, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetLookup, BTreeSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetLookup, FlatSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookup, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookup, FlatMap)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
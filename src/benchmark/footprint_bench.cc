@@ -0,0 +1,84 @@
+// Heap footprint of the AvlTree based containers: bytes per element for
+// small and large trees, and the cost of an empty one.
+
+#include <cstdlib>
+#include <new>
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#define S21_USABLE_SIZE malloc_size
+#else
+#include <malloc.h>
+#define S21_USABLE_SIZE malloc_usable_size
+#endif
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+// Same accounting as in flat_bench.cc: the real usable size of every block.
+static std::size_t live_bytes = 0;
+static std::size_t live_blocks = 0;
+
+__attribute__((noinline)) void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc{};
+  live_bytes += S21_USABLE_SIZE(ptr);
+  ++live_blocks;
+  return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+  if (ptr) {
+    live_bytes -= S21_USABLE_SIZE(ptr);
+    --live_blocks;
+  }
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+void small_sizes(benchmark::internal::Benchmark *bench) {
+  bench->Arg(0)->Arg(1)->Arg(10)->Arg(100);
+  s21_bench::sizes(bench);
+}
+
+template <typename Container>
+void fill(Container &set, const std::vector<std::int64_t> &keys) {
+  for (auto key : keys) set.insert(static_cast<int>(key));
+}
+
+void fill(s21::map<int, int> &map, const std::vector<std::int64_t> &keys) {
+  for (auto key : keys) map.insert(static_cast<int>(key), 0);
+}
+
+template <typename Container>
+void BM_Footprint(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    std::size_t bytes = live_bytes;
+    std::size_t blocks = live_blocks;
+    Container container;
+    fill(container, keys);
+    bytes = live_bytes - bytes;
+    blocks = live_blocks - blocks;
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.counters["blocks"] = static_cast<double>(blocks);
+    state.counters["node_sizeof"] =
+        static_cast<double>(sizeof(s21::Node<typename Container::value_type>));
+    if (!keys.empty())
+      state.counters["bytes_per_elem"] =
+          static_cast<double>(bytes) / keys.size();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Footprint, s21::set<int>)
+    ->Apply(small_sizes)
+    ->Iterations(1);
+BENCHMARK_TEMPLATE(BM_Footprint, s21::map<int, int>)
+    ->Apply(small_sizes)
+    ->Iterations(1);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+// Lookups in the Eytzinger ordered frozen_set against the AvlTree it is
+// built from and against binary search over the sorted flat_set.
+
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+using Key = std::uint64_t;
+
+template <typename Set>
+Set make_set(const std::vector<std::int64_t> &keys);
+
+template <>
+s21::set<Key> make_set(const std::vector<std::int64_t> &keys) {
+  s21::set<Key> set;
+  for (auto key : keys) set.insert(key);
+  return set;
+}
+
+template <>
+s21::flat_set<Key> make_set(const std::vector<std::int64_t> &keys) {
+  s21::flat_set<Key> set;
+  set.insert(keys.begin(), keys.end());
+  return set;
+}
+
+template <>
+s21::frozen_set<Key> make_set(const std::vector<std::int64_t> &keys) {
+  s21::set<Key> source = make_set<s21::set<Key>>(keys);
+  return s21::frozen_set<Key>{source};
+}
+
+// Probes cycle through hits, the odd keys, and misses in between.
+template <typename Set>
+void BM_Contains(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set = make_set<Set>(keys);
+  std::vector<Key> probes(keys.begin(), keys.end());
+  for (std::size_t i = 0; i < probes.size(); i += 2) --probes[i];
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.contains(probes[i]));
+    if (++i == probes.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set>
+void BM_LowerBound(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Set set = make_set<Set>(keys);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.lower_bound(keys[i] - 1));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using AvlSet = s21::set<Key>;
+using FlatSet = s21::flat_set<Key>;
+using FrozenSet = s21::frozen_set<Key>;
+
+BENCHMARK_TEMPLATE(BM_Contains, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Contains, FlatSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Contains, FrozenSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LowerBound, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LowerBound, FrozenSet)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,61 @@
+// Full in-order walks and range scans over string keys, where every key
+// compare on the way costs a string comparison.
+
+#include <set>
+#include <string>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+// Keys sharing a long prefix, so that comparing two of them is not decided
+// by the first byte.
+std::vector<std::string> string_keys(std::size_t n) {
+  std::vector<std::string> keys;
+  keys.reserve(n);
+  for (auto key : s21_bench::shuffled_keys(n))
+    keys.push_back("config/section/entry_" + std::to_string(key));
+  return keys;
+}
+
+template <typename Set>
+void BM_IterateStrings(benchmark::State &state) {
+  Set set;
+  for (const auto &key : string_keys(state.range(0))) set.insert(key);
+  for (auto _ : state) {
+    std::size_t length{};
+    for (auto it = set.begin(); it != set.end(); ++it) length += (*it).size();
+    benchmark::DoNotOptimize(length);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Visits about a tenth of the keys starting from the middle.
+void BM_RangeStrings(benchmark::State &state) {
+  auto keys = string_keys(state.range(0));
+  s21::set<std::string> set;
+  for (const auto &key : keys) set.insert(key);
+  std::vector<std::string> sorted(keys);
+  std::sort(sorted.begin(), sorted.end());
+  const std::string &lo = sorted[sorted.size() / 2];
+  const std::string &hi = sorted[sorted.size() / 2 + sorted.size() / 10];
+  for (auto _ : state) {
+    std::size_t length{};
+    set.for_each_in_range(
+        lo, hi, [&length](const std::string &key) { length += key.size(); });
+    benchmark::DoNotOptimize(length);
+  }
+  state.SetItemsProcessed(state.iterations() * (sorted.size() / 10));
+}
+
+using AvlSet = s21::set<std::string>;
+using StdSet = std::set<std::string>;
+
+BENCHMARK_TEMPLATE(BM_IterateStrings, AvlSet)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_IterateStrings, StdSet)->Apply(s21_bench::sizes);
+BENCHMARK(BM_RangeStrings)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
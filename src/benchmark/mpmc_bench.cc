@@ -0,0 +1,72 @@
+// mpmc_queue against an s21::Queue behind one mutex, from 1 to 64 threads.
+// Every thread is both a producer and a consumer: it pushes one task and
+// pops one task per iteration, so the queue never runs dry and every
+// operation contends on the shared ends.
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::size_t kCapacity = 1024;
+
+// the baseline the ring replaces
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t) {}
+
+  void push(std::int64_t value) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    queue_.push(value);
+  }
+
+  void pop(std::int64_t &value) {
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (!queue_.empty()) {
+          value = queue_.front();
+          queue_.pop();
+          return;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<std::int64_t> queue_;
+};
+
+using MpmcQueue = s21::mpmc_queue<std::int64_t>;
+
+template <typename Queue>
+Queue &shared_queue() {
+  static Queue *queue = new Queue{kCapacity};
+  return *queue;
+}
+
+template <typename Queue>
+void BM_PushPop(benchmark::State &state) {
+  Queue &queue = shared_queue<Queue>();
+  std::int64_t value = state.thread_index(), sum{};
+  for (auto _ : state) {
+    queue.push(value);
+    queue.pop(value);
+    sum += value;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_PushPop, MpmcQueue)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockedQueue)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
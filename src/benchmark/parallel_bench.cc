@@ -0,0 +1,78 @@
+// Scaling of parallel_reduce and parallel_for_each over a map with the
+// number of threads, against the serial iterator loop. Threads are the
+// second argument, the work per element is a few dozen multiplications so
+// that the walk is not purely memory bound.
+
+#include <cstdint>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+using Map = s21::map<std::int64_t, std::int64_t>;
+
+Map make_map(std::int64_t n) {
+  Map map;
+  for (auto key : s21_bench::shuffled_keys(n)) map.insert(key, key);
+  return map;
+}
+
+std::int64_t work(std::int64_t value) {
+  std::uint64_t h = value;
+  for (int i = 0; i < 32; ++i) h = h * 0x9e3779b97f4a7c15ULL + 1;
+  return static_cast<std::int64_t>(h >> 40);
+}
+
+void thread_args(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t n = 100000; n <= S21_BENCH_MAX_SIZE; n *= 10)
+    for (std::int64_t threads : {1, 2, 4, 8}) bench->Args({n, threads});
+}
+
+void BM_SerialLoop(benchmark::State &state) {
+  Map map = make_map(state.range(0));
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (auto it = map.begin(); it != map.end(); ++it)
+      sum += work((*it).second);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelReduce(benchmark::State &state) {
+  Map map = make_map(state.range(0));
+  for (auto _ : state) {
+    std::int64_t sum = s21::parallel_reduce(
+        map, std::int64_t{},
+        [](std::int64_t acc, const Map::value_type &p) {
+          return acc + work(p.second);
+        },
+        [](std::int64_t a, std::int64_t b) { return a + b; },
+        state.range(1));
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelForEach(benchmark::State &state) {
+  Map map = make_map(state.range(0));
+  for (auto _ : state) {
+    s21::parallel_for_each(
+        map, [](Map::value_type &p) { p.second = work(p.second); },
+        state.range(1));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SerialLoop)
+    ->RangeMultiplier(10)
+    ->Range(100000, S21_BENCH_MAX_SIZE)
+    ->UseRealTime();
+BENCHMARK(BM_ParallelReduce)->Apply(thread_args)->UseRealTime();
+BENCHMARK(BM_ParallelForEach)->Apply(thread_args)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
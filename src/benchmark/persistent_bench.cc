@@ -0,0 +1,74 @@
+// "Copy, then modify k keys": persistent_map shares all but the changed
+// paths with the original, s21::map copies every node.
+
+#include <cstdlib>
+#include <new>
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#define S21_USABLE_SIZE malloc_size
+#else
+#include <malloc.h>
+#define S21_USABLE_SIZE malloc_usable_size
+#endif
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+// Same accounting as in flat_bench.cc.
+static std::size_t live_bytes = 0;
+
+__attribute__((noinline)) void *operator new(std::size_t size) {
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc{};
+  live_bytes += S21_USABLE_SIZE(ptr);
+  return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+  if (ptr) live_bytes -= S21_USABLE_SIZE(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+// 10^3 ... S21_BENCH_MAX_SIZE elements, 1, 16 and 256 modified keys
+void sizes_and_edits(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t n = 1000; n <= S21_BENCH_MAX_SIZE; n *= 10)
+    for (std::int64_t k : {1, 16, 256}) bench->Args({n, k});
+}
+
+// state.range(0) keys, state.range(1) of them reassigned in every copy. The
+// extra heap the copy keeps alive is reported as bytes_per_copy.
+template <typename Map>
+void BM_CopyModify(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  std::size_t edits = state.range(1);
+  Map base;
+  for (auto key : keys) base.insert(key, key);
+  std::size_t i{};
+  double bytes{};
+  for (auto _ : state) {
+    std::size_t before = live_bytes;
+    Map copy{base};
+    for (std::size_t j = 0; j < edits; ++j) {
+      copy.insert_or_assign(keys[i], -keys[i]);
+      if (++i == keys.size()) i = 0;
+    }
+    bytes = static_cast<double>(live_bytes - before);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.counters["bytes_per_copy"] = bytes;
+  state.SetItemsProcessed(state.iterations());
+}
+
+using AvlMap = s21::map<std::int64_t, std::int64_t>;
+using PersistentMap = s21::persistent_map<std::int64_t, std::int64_t>;
+
+BENCHMARK_TEMPLATE(BM_CopyModify, AvlMap)->Apply(sizes_and_edits);
+BENCHMARK_TEMPLATE(BM_CopyModify, PersistentMap)->Apply(sizes_and_edits);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,78 @@
+// s21::priority_queue as a binary and a 4-ary heap, against
+// std::priority_queue and the s21::set the scheduler used as a queue until
+// now (insert to push, erase(begin()) to pop the smallest). The keys are
+// distinct, so the set holds the same elements as the heaps. The push-pop
+// benchmark pushes n keys and pops them all, the build benchmark constructs
+// a heap from n keys at once.
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+using BinaryHeap = s21::priority_queue<std::int64_t, s21::Vector<std::int64_t>,
+                                       std::less<std::int64_t>, 2>;
+using QuaternaryHeap =
+    s21::priority_queue<std::int64_t, s21::Vector<std::int64_t>,
+                        std::less<std::int64_t>, 4>;
+using StdHeap = std::priority_queue<std::int64_t>;
+
+// the set-as-heap pattern, behind the priority queue interface
+class SetHeap {
+ public:
+  SetHeap() = default;
+  template <typename InputIt>
+  SetHeap(InputIt first, InputIt last) {
+    for (; first != last; ++first) set_.insert(*first);
+  }
+
+  void push(std::int64_t value) { set_.insert(value); }
+  std::int64_t top() { return *set_.begin(); }
+  void pop() { set_.erase(set_.begin()); }
+
+ private:
+  s21::set<std::int64_t> set_;
+};
+
+template <typename Heap>
+void BM_PushPop(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Heap heap;
+    for (std::int64_t key : keys) heap.push(key);
+    std::int64_t sum{};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      sum += heap.top();
+      heap.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Heap>
+void BM_Build(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Heap heap(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(heap.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushPop, BinaryHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, QuaternaryHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, StdHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_PushPop, SetHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Build, QuaternaryHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Build, StdHeap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Build, SetHeap)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,76 @@
+// Push and pop throughput of s21::Queue against std::queue. The steady
+// benchmark keeps a fixed backlog in the queue and pushes one element for
+// every one it pops, the way a message queue runs; the burst benchmark fills
+// the queue to n and drains it again.
+
+#include <cstdint>
+#include <queue>
+#include <string>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+struct Message {
+  std::uint64_t id, a, b, c;
+};
+
+template <typename Queue>
+void BM_Steady(benchmark::State &state) {
+  Queue queue;
+  std::uint64_t id{};
+  for (std::int64_t i = 0; i < state.range(0); ++i)
+    queue.push(Message{id++, 1, 2, 3});
+  for (auto _ : state) {
+    queue.push(Message{id++, 1, 2, 3});
+    benchmark::DoNotOptimize(queue.front().id);
+    queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Queue>
+void BM_Burst(benchmark::State &state) {
+  Queue queue;
+  for (auto _ : state) {
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+      queue.push(Message{static_cast<std::uint64_t>(i), 1, 2, 3});
+    std::uint64_t sum{};
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      sum += queue.front().id;
+      queue.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Queue>
+void BM_BurstString(benchmark::State &state) {
+  Queue queue;
+  std::string payload(32, 'm');
+  for (auto _ : state) {
+    for (std::int64_t i = 0; i < state.range(0); ++i) queue.push(payload);
+    std::size_t sum{};
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      sum += queue.front().size();
+      queue.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Steady, s21::Queue<Message>)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Steady, std::queue<Message>)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Burst, s21::Queue<Message>)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Burst, std::queue<Message>)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_BurstString, s21::Queue<std::string>)
+    ->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_BurstString, std::queue<std::string>)
+    ->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,37 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_BENCHMARK_S21_BENCH_H_
+#define CPP2_S21_CONTAINERS_SRC_BENCHMARK_S21_BENCH_H_
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Upper bound of the element counts the benchmarks are run with. The default
+// keeps a full run within a few minutes, the 10^8 runs are requested with
+// make bench BENCH_DEFS=-DS21_BENCH_MAX_SIZE=100000000
+#ifndef S21_BENCH_MAX_SIZE
+#define S21_BENCH_MAX_SIZE 1000000
+#endif
+
+namespace s21_bench {
+
+// 10^3, 10^4, ... up to S21_BENCH_MAX_SIZE
+inline void sizes(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t n = 1000; n <= S21_BENCH_MAX_SIZE; n *= 10) bench->Arg(n);
+}
+
+// n distinct odd keys in random order, so every even key is a miss
+inline std::vector<std::int64_t> shuffled_keys(std::size_t n,
+                                               std::uint64_t seed = 42) {
+  std::vector<std::int64_t> keys(n);
+  for (std::size_t i = 0; i < n; ++i)
+    keys[i] = static_cast<std::int64_t>(i) * 2 + 1;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64{seed});
+  return keys;
+}
+
+}  // namespace s21_bench
+
+#endif  // CPP2_S21_CONTAINERS_SRC_BENCHMARK_S21_BENCH_H_
@@ -0,0 +1,138 @@
+// spsc_queue against an s21::Queue behind a mutex, between one producer and
+// one consumer thread. The ping-pong benchmark bounces one message through a
+// pair of queues and reports the round trip; the throughput benchmark
+// streams kItems messages, one at a time or in batches of state.range(0).
+// Both sides spin with a yield, so the numbers on a single core measure the
+// handover through the scheduler more than the queue.
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::int64_t kItems = 1 << 18;
+
+// the baseline the lock-free queue replaces
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t) {}
+
+  bool try_push(std::int64_t value) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(std::int64_t &value) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+  template <typename InputIt>
+  std::size_t push_n(InputIt first, std::size_t n) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    for (std::size_t i = 0; i < n; ++i, ++first) queue_.push(*first);
+    return n;
+  }
+
+  template <typename OutputIt>
+  std::size_t pop_n(OutputIt out, std::size_t max_n) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    std::size_t n = 0;
+    for (; n < max_n && !queue_.empty(); ++n, ++out) {
+      *out = queue_.front();
+      queue_.pop();
+    }
+    return n;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<std::int64_t> queue_;
+};
+
+using SpscQueue = s21::spsc_queue<std::int64_t>;
+
+template <typename Queue>
+void BM_PingPong(benchmark::State &state) {
+  Queue ping{kCapacity}, pong{kCapacity};
+  std::atomic<bool> done{false};
+  std::thread echo{[&] {
+    std::int64_t value;
+    while (!done.load(std::memory_order_relaxed)) {
+      if (ping.try_pop(value))
+        while (!pong.try_push(value)) std::this_thread::yield();
+      else
+        std::this_thread::yield();
+    }
+  }};
+  std::int64_t value{};
+  for (auto _ : state) {
+    while (!ping.try_push(value)) std::this_thread::yield();
+    while (!pong.try_pop(value)) std::this_thread::yield();
+    ++value;
+  }
+  done = true;
+  echo.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Queue>
+void BM_Throughput(benchmark::State &state) {
+  std::size_t batch = state.range(0);
+  for (auto _ : state) {
+    Queue queue{kCapacity};
+    std::thread consumer{[&queue, batch] {
+      std::vector<std::int64_t> out(batch);
+      std::int64_t sum{}, received{};
+      while (received < kItems) {
+        std::size_t n = batch == 1 ? queue.try_pop(out[0])
+                                   : queue.pop_n(out.begin(), batch);
+        for (std::size_t i = 0; i < n; ++i) sum += out[i];
+        received += n;
+        if (!n) std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(sum);
+    }};
+    std::vector<std::int64_t> in(batch);
+    for (std::int64_t sent = 0; sent < kItems;) {
+      std::size_t n = std::min<std::int64_t>(batch, kItems - sent);
+      for (std::size_t i = 0; i < n; ++i) in[i] = sent + i;
+      std::size_t pushed = batch == 1 ? queue.try_push(in[0])
+                                      : queue.push_n(in.begin(), n);
+      sent += pushed;
+      if (!pushed) std::this_thread::yield();
+    }
+    consumer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+BENCHMARK_TEMPLATE(BM_PingPong, SpscQueue)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPong, LockedQueue)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, SpscQueue)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Throughput, LockedQueue)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,68 @@
+// Push and pop cost of s21::Stack over a linked backend (std::list, one node
+// per element as the old Stack had) and over its default contiguous
+// s21::Vector, with std::stack as the reference. The depth benchmark pushes
+// n frames and pops them all, the way a depth first walk does; the
+// oscillate benchmark keeps a shallow stack and pushes and pops one frame
+// at a time.
+
+#include <cstdint>
+#include <list>
+#include <stack>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+struct Frame {
+  Frame(std::uint64_t node, std::uint64_t parent, std::uint64_t depth)
+      : node(node), parent(parent), depth(depth) {}
+
+  std::uint64_t node, parent, depth;
+};
+
+using LinkedStack = s21::Stack<Frame, std::list<Frame>>;
+using VectorStack = s21::Stack<Frame>;
+using StdStack = std::stack<Frame, std::vector<Frame>>;
+
+template <typename Stack>
+void BM_Depth(benchmark::State &state) {
+  Stack stack;
+  for (auto _ : state) {
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+      stack.emplace(static_cast<std::uint64_t>(i), 0, 0);
+    std::uint64_t sum{};
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      sum += stack.top().node;
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Stack>
+void BM_Oscillate(benchmark::State &state) {
+  Stack stack;
+  for (std::int64_t i = 0; i < state.range(0); ++i)
+    stack.push(Frame{static_cast<std::uint64_t>(i), 0, 0});
+  std::uint64_t id{};
+  for (auto _ : state) {
+    stack.push(Frame{id++, 1, 2});
+    benchmark::DoNotOptimize(stack.top().node);
+    stack.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Depth, LinkedStack)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Depth, VectorStack)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Depth, StdStack)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Oscillate, LinkedStack)->Arg(64);
+BENCHMARK_TEMPLATE(BM_Oscillate, VectorStack)->Arg(64);
+BENCHMARK_TEMPLATE(BM_Oscillate, StdStack)->Arg(64);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+// Open-addressing unordered_map against std::unordered_map and the AvlTree
+// based s21::map: lookup hits and misses, insertion and erasure.
+
+#include <unordered_map>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+template <typename Map>
+void fill(Map &map, const std::vector<std::int64_t> &keys) {
+  for (auto key : keys) map.insert({key, key});
+}
+
+template <typename Map>
+bool has_key(Map &map, std::int64_t key) {
+  return map.contains(key);
+}
+
+// no contains before C++20
+template <typename Key, typename T>
+bool has_key(std::unordered_map<Key, T> &map, std::int64_t key) {
+  return map.count(key);
+}
+
+template <typename Map>
+void erase_key(Map &map, std::int64_t key) {
+  map.erase(key);
+}
+
+// s21::map has no find, insert hands back the iterator of the present key
+template <typename Key, typename T>
+void erase_key(s21::map<Key, T> &map, std::int64_t key) {
+  map.erase(map.insert(key, T{}).first);
+}
+
+template <typename Map>
+void BM_LookupHit(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Map map;
+  fill(map, keys);
+  std::size_t i{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.at(keys[i]));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_LookupMiss(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  Map map;
+  fill(map, keys);
+  std::size_t i{};
+  for (auto _ : state) {
+    // the keys are odd, their even neighbours are never present
+    benchmark::DoNotOptimize(has_key(map, keys[i] + 1));
+    if (++i == keys.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+void BM_Insert(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    Map map;
+    fill(map, keys);
+    benchmark::DoNotOptimize(map.size());
+    state.PauseTiming();
+    map.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename Map>
+void BM_Erase(benchmark::State &state) {
+  auto keys = s21_bench::shuffled_keys(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    Map map;
+    fill(map, keys);
+    state.ResumeTiming();
+    for (auto key : keys) erase_key(map, key);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+using HashMap = s21::unordered_map<std::int64_t, std::int64_t>;
+using StdHashMap = std::unordered_map<std::int64_t, std::int64_t>;
+using AvlMap = s21::map<std::int64_t, std::int64_t>;
+
+BENCHMARK_TEMPLATE(BM_LookupHit, HashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LookupHit, StdHashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LookupHit, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LookupMiss, HashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LookupMiss, StdHashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LookupMiss, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Insert, HashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Insert, StdHashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Insert, AvlMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Erase, HashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Erase, StdHashMap)->Apply(s21_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Erase, AvlMap)->Apply(s21_bench::sizes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
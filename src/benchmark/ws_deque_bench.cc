@@ -0,0 +1,96 @@
+// Fork-join tree sum on ws_deque: a worker splits its range in half until it
+// is below kGrain elements, leaving the right halves at the bottom of its
+// deque, sums the leaf and pops the next half. Idle workers steal the oldest,
+// largest halves from the top of a random victim. state.range(0) is the
+// number of workers, the serial loop is the baseline.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "s21_bench.h"
+
+namespace {
+
+constexpr std::uint32_t kElements = 1 << 22;
+constexpr std::uint32_t kGrain = 4096;
+
+struct Range {
+  std::uint32_t first, last;
+};
+
+std::int64_t tree_sum(const std::vector<std::int64_t> &data, int workers) {
+  std::vector<std::unique_ptr<s21::ws_deque<Range>>> deques;
+  for (int i = 0; i < workers; ++i)
+    deques.push_back(std::make_unique<s21::ws_deque<Range>>());
+  std::atomic<std::int64_t> total{0};
+  std::atomic<std::uint32_t> remaining{
+      static_cast<std::uint32_t>(data.size())};
+  deques[0]->push(Range{0, static_cast<std::uint32_t>(data.size())});
+  auto work = [&](int self) {
+    std::minstd_rand rng(self + 1);
+    Range range;
+    while (remaining.load(std::memory_order_acquire)) {
+      if (!deques[self]->pop(range) &&
+          !deques[rng() % workers]->steal(range)) {
+        std::this_thread::yield();
+        continue;
+      }
+      while (range.last - range.first > kGrain) {
+        std::uint32_t middle = range.first + (range.last - range.first) / 2;
+        deques[self]->push(Range{middle, range.last});
+        range.last = middle;
+      }
+      total.fetch_add(std::accumulate(data.begin() + range.first,
+                                      data.begin() + range.last,
+                                      std::int64_t{}),
+                      std::memory_order_relaxed);
+      remaining.fetch_sub(range.last - range.first, std::memory_order_release);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < workers; ++i) threads.emplace_back(work, i);
+  work(0);
+  for (auto &thread : threads) thread.join();
+  return total.load();
+}
+
+const std::vector<std::int64_t> &input() {
+  static std::vector<std::int64_t> data = [] {
+    std::vector<std::int64_t> filled(kElements);
+    std::iota(filled.begin(), filled.end(), 0);
+    return filled;
+  }();
+  return data;
+}
+
+void BM_Serial(benchmark::State &state) {
+  const auto &data = input();
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        std::accumulate(data.begin(), data.end(), std::int64_t{}));
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+void BM_TreeSum(benchmark::State &state) {
+  const auto &data = input();
+  for (auto _ : state)
+    benchmark::DoNotOptimize(tree_sum(data, state.range(0)));
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+BENCHMARK(BM_Serial)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TreeSum)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+BENCHMARK_MAIN();
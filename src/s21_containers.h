@@ -2,11 +2,34 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H_
 
 #include "s21_list/list/s21_list.h"
+#include "s21_set_map/btree_map/s21_btree_map.h"
+#include "s21_set_map/btree_set/s21_btree_set.h"
+#include "s21_set_map/concurrent_map/s21_concurrent_map.h"
+#include "s21_set_map/flat_map/s21_flat_map.h"
+#include "s21_set_map/flat_set/s21_flat_set.h"
+#include "s21_set_map/frozen_map/s21_frozen_map.h"
+#include "s21_set_map/frozen_set/s21_frozen_set.h"
 #include "s21_set_map/map/s21_map.h"
+#include "s21_set_map/mapped_table/s21_mapped_table.h"
+#include "s21_set_map/multimap/s21_multimap.h"
+#include "s21_set_map/multiset/s21_multiset.h"
+#include "s21_set_map/parallel/s21_parallel.h"
+#include "s21_set_map/persistent_map/s21_persistent_map.h"
+#include "s21_set_map/persistent_set/s21_persistent_set.h"
 #include "s21_set_map/set/s21_set.h"
+#include "s21_stack_queue_array/s21_aligned_array/s21_aligned_array.h"
 #include "s21_stack_queue_array/s21_array/s21_array.h"
+#include "s21_stack_queue_array/s21_blocking_queue/s21_blocking_queue.h"
+#include "s21_stack_queue_array/s21_deque/s21_deque.h"
+#include "s21_stack_queue_array/s21_mpmc_queue/s21_mpmc_queue.h"
+#include "s21_stack_queue_array/s21_priority_queue/s21_priority_queue.h"
 #include "s21_stack_queue_array/s21_queue/s21_queue.h"
+#include "s21_stack_queue_array/s21_spsc_queue/s21_spsc_queue.h"
 #include "s21_stack_queue_array/s21_stack/s21_stack.h"
+#include "s21_stack_queue_array/s21_ws_deque/s21_ws_deque.h"
+#include "s21_unordered_set_map/unordered_map/s21_unordered_map.h"
+#include "s21_unordered_set_map/unordered_set/s21_unordered_set.h"
+#include "s21_vector/aligned_vector/s21_aligned_vector.h"
 #include "s21_vector/vector/s21_vector.h"
 
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H_
@@ -0,0 +1,90 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BLOOM_FILTER_S21_BLOOM_FILTER_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BLOOM_FILTER_S21_BLOOM_FILTER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace s21 {
+
+// Lookup filter policies of set and map. A policy sees every key that goes
+// into the tree and answers may_contain(key) == false only for keys that are
+// definitely missing, letting contains and find skip the tree walk. Keys can
+// not be taken out of a filter, so erase only counts them, and the container
+// rebuilds the filter from the tree once it reports full() or stale().
+
+// The default policy: every key may be present, the checks compile away.
+template <typename Key>
+struct NoFilter {
+  void insert(const Key&) {}
+  void erase(std::size_t) {}
+  void invalidate() {}
+  void reset(std::size_t) {}
+  void clear() {}
+  bool may_contain(const Key&) const { return true; }
+  bool full() const { return false; }
+  bool stale() const { return false; }
+};
+
+// Blocked Bloom filter: a key sets one bit in each of the eight words of a
+// single 64-byte block, so a lookup touches one cache line. It is sized for
+// twice the keys it is reset with at BitsPerKey bits each, and asks for a
+// rebuild when that fills up or when a quarter of its keys were erased.
+template <typename Key, std::size_t BitsPerKey = 16,
+          typename Hash = std::hash<Key>>
+class BloomFilter {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kBlockBytes = 64;
+  static constexpr size_type kMinKeys = 64;
+
+  BloomFilter() noexcept;
+  BloomFilter(const BloomFilter& other);
+  BloomFilter(BloomFilter&& other) noexcept;
+  ~BloomFilter();
+
+  BloomFilter& operator=(const BloomFilter& other);
+  BloomFilter& operator=(BloomFilter&& other) noexcept;
+
+  void insert(const Key& key);
+  void erase(size_type count);
+  void invalidate();
+  void reset(size_type keys);
+  void clear();
+  void swap(BloomFilter& other) noexcept;
+
+  bool may_contain(const Key& key) const;
+  bool full() const;
+  bool stale() const;
+
+  // Probability that may_contain is true for a key that was never inserted,
+  // computed from the bits currently set.
+  double false_positive_rate() const;
+  size_type memory_usage() const;
+  size_type get_capacity() const;
+
+ private:
+  static constexpr size_type kWords = 8;
+
+  struct alignas(kBlockBytes) Block {
+    std::uint64_t words[kWords];
+  };
+
+  static std::uint64_t hash(const Key& key);
+  size_type block_index(std::uint64_t h) const;
+  static std::uint64_t bit_of(std::uint64_t h, size_type word);
+
+  Block* blocks_;
+  size_type num_blocks_;
+  size_type capacity_;
+  size_type count_;
+  size_type erased_;
+};
+};  // namespace s21
+
+#include "s21_bloom_filter.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BLOOM_FILTER_S21_BLOOM_FILTER_H_
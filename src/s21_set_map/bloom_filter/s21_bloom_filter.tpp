@@ -0,0 +1,191 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>::BloomFilter() noexcept
+    : blocks_{}, num_blocks_{}, capacity_{}, count_{}, erased_{} {};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>::BloomFilter(const BloomFilter& other)
+    : blocks_{},
+      num_blocks_{other.num_blocks_},
+      capacity_{other.capacity_},
+      count_{other.count_},
+      erased_{other.erased_} {
+  if (!num_blocks_) return;
+  blocks_ = new Block[num_blocks_];
+  for (size_type i = 0; i < num_blocks_; ++i) blocks_[i] = other.blocks_[i];
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>::BloomFilter(BloomFilter&& other) noexcept
+    : BloomFilter() {
+  swap(other);
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>::~BloomFilter() {
+  delete[] blocks_;
+};
+
+/* ------------------- OPERATORS --------------------- */
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>&
+BloomFilter<Key, BitsPerKey, Hash>::operator=(const BloomFilter& other) {
+  if (this != &other) {
+    BloomFilter copy{other};
+    swap(copy);
+  }
+  return *this;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+BloomFilter<Key, BitsPerKey, Hash>&
+BloomFilter<Key, BitsPerKey, Hash>::operator=(BloomFilter&& other) noexcept {
+  swap(other);
+  return *this;
+};
+
+/* ------------------- MODIFIERS --------------------- */
+
+// The filter must not be full(), the container rebuilds it before.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::insert(const Key& key) {
+  std::uint64_t h = hash(key);
+  Block& block = blocks_[block_index(h)];
+  for (size_type i = 0; i < kWords; ++i) block.words[i] |= bit_of(h, i);
+  ++count_;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::erase(size_type count) {
+  erased_ += count;
+};
+
+// Makes full() true, for when keys went into the container behind the
+// filter's back, e.g. by a merge.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::invalidate() {
+  count_ = capacity_;
+};
+
+// Empties the filter and sizes it for keys insertions plus as many again.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::reset(size_type keys) {
+  size_type capacity = keys ? std::max(keys * 2, kMinKeys) : 0;
+  size_type num_blocks =
+      (capacity * BitsPerKey + kBlockBytes * 8 - 1) / (kBlockBytes * 8);
+  if (num_blocks != num_blocks_) {
+    Block* blocks = num_blocks ? new Block[num_blocks] : nullptr;
+    delete[] blocks_;
+    blocks_ = blocks;
+    num_blocks_ = num_blocks;
+  }
+  for (size_type i = 0; i < num_blocks_; ++i) blocks_[i] = Block{};
+  capacity_ = capacity;
+  count_ = 0;
+  erased_ = 0;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::clear() {
+  reset(0);
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+void BloomFilter<Key, BitsPerKey, Hash>::swap(BloomFilter& other) noexcept {
+  std::swap(blocks_, other.blocks_);
+  std::swap(num_blocks_, other.num_blocks_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(count_, other.count_);
+  std::swap(erased_, other.erased_);
+};
+
+/* ------------------- LOOKUP --------------------- */
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+bool BloomFilter<Key, BitsPerKey, Hash>::may_contain(const Key& key) const {
+  if (!num_blocks_) return false;
+  std::uint64_t h = hash(key);
+  const Block& block = blocks_[block_index(h)];
+  std::uint64_t missing{};
+  for (size_type i = 0; i < kWords; ++i)
+    missing |= bit_of(h, i) & ~block.words[i];
+  return !missing;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+bool BloomFilter<Key, BitsPerKey, Hash>::full() const {
+  return count_ >= capacity_;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+bool BloomFilter<Key, BitsPerKey, Hash>::stale() const {
+  return erased_ * 4 > count_;
+};
+
+/* ------------------- STATISTICS --------------------- */
+
+// A missing key passes when all eight of its bits are set, each one with the
+// share of ones in its word. Averaged over the blocks it may land in.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+double BloomFilter<Key, BitsPerKey, Hash>::false_positive_rate() const {
+  if (!num_blocks_) return 0.0;
+  double sum{};
+  for (size_type b = 0; b < num_blocks_; ++b) {
+    double p = 1.0;
+    for (size_type i = 0; i < kWords; ++i)
+      p *= __builtin_popcountll(blocks_[b].words[i]) / 64.0;
+    sum += p;
+  }
+  return sum / num_blocks_;
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+typename BloomFilter<Key, BitsPerKey, Hash>::size_type
+BloomFilter<Key, BitsPerKey, Hash>::memory_usage() const {
+  return num_blocks_ * sizeof(Block);
+};
+
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+typename BloomFilter<Key, BitsPerKey, Hash>::size_type
+BloomFilter<Key, BitsPerKey, Hash>::get_capacity() const {
+  return capacity_;
+};
+
+/* ------------------- HELPERS --------------------- */
+
+// std::hash is the identity for integers, so its result is mixed with the
+// murmur3 finalizer before the bits are taken apart.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+std::uint64_t BloomFilter<Key, BitsPerKey, Hash>::hash(const Key& key) {
+  std::uint64_t h = Hash{}(key);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+};
+
+// The high half picks the block, without a division.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+typename BloomFilter<Key, BitsPerKey, Hash>::size_type
+BloomFilter<Key, BitsPerKey, Hash>::block_index(std::uint64_t h) const {
+  return ((h >> 32) * num_blocks_) >> 32;
+};
+
+// The low half times an odd salt per word picks the bit in that word.
+template <typename Key, std::size_t BitsPerKey, typename Hash>
+std::uint64_t BloomFilter<Key, BitsPerKey, Hash>::bit_of(std::uint64_t h,
+                                                         size_type word) {
+  static constexpr std::uint32_t kSalt[kWords] = {
+      0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+      0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+  std::uint32_t bit = (static_cast<std::uint32_t>(h) * kSalt[word]) >> 26;
+  return std::uint64_t{1} << bit;
+};
+
+}  // namespace s21
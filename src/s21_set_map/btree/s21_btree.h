@@ -0,0 +1,159 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_S21_BTREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_S21_BTREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../tree/s21_key_of.h"
+
+namespace s21 {
+
+// Number of values kept in one node: the node is sized to about four 64-byte
+// cache lines so that a lookup touches few lines per level.
+template <typename V>
+constexpr std::size_t btree_node_slots() {
+  constexpr std::size_t kNodeBytes = 256;
+  constexpr std::size_t kHeaderBytes = 16;
+  constexpr std::size_t kSlots = (kNodeBytes - kHeaderBytes) / sizeof(V);
+  return kSlots < 3 ? 3 : kSlots;
+}
+
+template <typename V, std::size_t N>
+struct BTreeNode {
+  V& value(std::size_t i);
+  const V& value(std::size_t i) const;
+
+  template <typename... Args>
+  void construct(std::size_t i, Args&&... args);
+  void destroy(std::size_t i);
+
+  template <typename... Args>
+  void emplace_value(std::size_t i, Args&&... args);
+  void remove_value(std::size_t i);
+
+  BTreeNode* parent = nullptr;
+  std::uint16_t position = 0;
+  std::uint16_t count = 0;
+  bool leaf = true;
+  alignas(V) unsigned char slots[sizeof(V) * N];
+};
+
+template <typename V, std::size_t N>
+struct BTreeInternalNode : BTreeNode<V, N> {
+  using base_type = BTreeNode<V, N>;
+
+  BTreeInternalNode() { base_type::leaf = false; }
+
+  void set_child(std::size_t i, base_type* node);
+  void insert_child(std::size_t i, base_type* node);
+  void remove_child(std::size_t i);
+
+  base_type* children[N + 1];
+};
+
+template <typename V, typename KeyOf>
+class BTree {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  static constexpr std::size_t kSlots = btree_node_slots<V>();
+
+  using key_type = typename KeyOf::key_type;
+  using value_type = V;
+  using node_type = BTreeNode<V, kSlots>;
+  using reference = V&;
+  using const_reference = const V&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = std::size_t;
+
+  BTree() noexcept;
+  BTree(const BTree& other);
+  BTree(BTree&& other) noexcept;
+  ~BTree();
+
+  BTree& operator=(const BTree& other);
+  BTree& operator=(BTree&& other) noexcept;
+
+  iterator begin();
+  iterator end();
+
+  bool empty() const;
+  size_type get_size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  void swap(BTree& other) noexcept;
+  void merge(BTree& other);
+
+  iterator find(const key_type& key);
+  iterator lower_bound(const key_type& key);
+
+  class Iterator {
+   public:
+    Iterator();
+    Iterator(node_type* node, size_type position);
+
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& it) const;
+    bool operator!=(const iterator& it) const;
+    V& operator*() const;
+    V* operator->() const;
+
+   protected:
+    friend class BTree;
+
+    node_type* node_;
+    size_type position_;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator{} {};
+    ConstIterator(const iterator& other) : Iterator{other} {};
+    const V& operator*() const;
+    const V* operator->() const;
+  };
+
+ private:
+  using internal_type = BTreeInternalNode<V, kSlots>;
+
+  static constexpr size_type kMinSlots = (kSlots - 1) / 2;
+
+  node_type* root_;
+  node_type* leftmost_;
+  node_type* rightmost_;
+  size_type size_;
+
+  static node_type* child(node_type* node, size_type i);
+  static size_type lower_bound_in_node(const node_type* node,
+                                       const key_type& key);
+  static bool equal_keys(const key_type& key, const value_type& value);
+
+  node_type* new_node(bool leaf);
+  void delete_node(node_type* node);
+  void delete_subtree(node_type* node);
+  node_type* copy_subtree(const node_type* other, node_type* parent);
+  void reset_edges();
+
+  void split(node_type* node);
+  void rebalance(node_type* node);
+  void rotate_right(node_type* left, node_type* node);
+  void rotate_left(node_type* node, node_type* right);
+  void merge_nodes(node_type* left, node_type* right);
+};
+};  // namespace s21
+
+#include "s21_btree.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_S21_BTREE_H_
@@ -0,0 +1,537 @@
+namespace s21 {
+
+/* ------------------------------ NODE -------------------------------- */
+
+template <typename V, std::size_t N>
+V& BTreeNode<V, N>::value(std::size_t i) {
+  return *std::launder(reinterpret_cast<V*>(slots) + i);
+}
+
+template <typename V, std::size_t N>
+const V& BTreeNode<V, N>::value(std::size_t i) const {
+  return *std::launder(reinterpret_cast<const V*>(slots) + i);
+}
+
+template <typename V, std::size_t N>
+template <typename... Args>
+void BTreeNode<V, N>::construct(std::size_t i, Args&&... args) {
+  ::new (static_cast<void*>(reinterpret_cast<V*>(slots) + i))
+      V(std::forward<Args>(args)...);
+}
+
+template <typename V, std::size_t N>
+void BTreeNode<V, N>::destroy(std::size_t i) {
+  value(i).~V();
+}
+
+template <typename V, std::size_t N>
+template <typename... Args>
+void BTreeNode<V, N>::emplace_value(std::size_t i, Args&&... args) {
+  for (std::size_t j = count; j > i; --j) {
+    construct(j, std::move(value(j - 1)));
+    destroy(j - 1);
+  }
+  construct(i, std::forward<Args>(args)...);
+  ++count;
+}
+
+template <typename V, std::size_t N>
+void BTreeNode<V, N>::remove_value(std::size_t i) {
+  destroy(i);
+  for (std::size_t j = i + 1; j < count; ++j) {
+    construct(j - 1, std::move(value(j)));
+    destroy(j);
+  }
+  --count;
+}
+
+template <typename V, std::size_t N>
+void BTreeInternalNode<V, N>::set_child(std::size_t i, base_type* node) {
+  children[i] = node;
+  node->parent = this;
+  node->position = static_cast<std::uint16_t>(i);
+}
+
+// Expects the separator value to be inserted already: the node then owns
+// count + 1 children slots and the ones from i are shifted right.
+template <typename V, std::size_t N>
+void BTreeInternalNode<V, N>::insert_child(std::size_t i, base_type* node) {
+  for (std::size_t j = base_type::count; j > i; --j) {
+    set_child(j, children[j - 1]);
+  }
+  set_child(i, node);
+}
+
+// Expects the separator value to be still present, see insert_child.
+template <typename V, std::size_t N>
+void BTreeInternalNode<V, N>::remove_child(std::size_t i) {
+  for (std::size_t j = i + 1; j <= base_type::count; ++j) {
+    set_child(j - 1, children[j]);
+  }
+}
+
+/* -------------------- CONSTRUCTORS / DESTRUCTORS ---------------------- */
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::BTree() noexcept
+    : root_{}, leftmost_{}, rightmost_{}, size_{} {};
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::BTree(const BTree& other) : BTree() {
+  if (other.root_) {
+    root_ = copy_subtree(other.root_, nullptr);
+    size_ = other.size_;
+    reset_edges();
+  }
+};
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::BTree(BTree&& other) noexcept : BTree() {
+  swap(other);
+};
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::~BTree() {
+  clear();
+};
+
+/* ---------------------------- OPERATORS ------------------------------- */
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>& BTree<V, KeyOf>::operator=(const BTree& other) {
+  if (this != &other) {
+    BTree tmp{other};
+    swap(tmp);
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>& BTree<V, KeyOf>::operator=(BTree&& other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+};
+
+/* ---------------------------- BEGIN / END ----------------------------- */
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::begin() {
+  return iterator{leftmost_, 0};
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::end() {
+  return iterator{rightmost_, rightmost_ ? rightmost_->count : size_type{}};
+};
+
+/* ----------------------------- CAPACITY ------------------------------- */
+
+template <typename V, typename KeyOf>
+bool BTree<V, KeyOf>::empty() const {
+  return !size_;
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::size_type BTree<V, KeyOf>::get_size() const {
+  return size_;
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::size_type BTree<V, KeyOf>::max_size() const {
+  return (std::numeric_limits<size_type>::max() / 2) / sizeof(V) / 10;
+};
+
+/* ----------------------------- MODIFIERS ------------------------------ */
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::clear() {
+  if (root_) delete_subtree(root_);
+  root_ = leftmost_ = rightmost_ = nullptr;
+  size_ = 0;
+};
+
+template <typename V, typename KeyOf>
+std::pair<typename BTree<V, KeyOf>::iterator, bool> BTree<V, KeyOf>::insert(
+    const value_type& value) {
+  if (!root_) root_ = leftmost_ = rightmost_ = new_node(true);
+  const key_type& key = KeyOf{}(value);
+  node_type* node = root_;
+  size_type i{};
+  while (true) {
+    i = lower_bound_in_node(node, key);
+    if (i < node->count && equal_keys(key, node->value(i)))
+      return {iterator{node, i}, false};
+    if (node->leaf) break;
+    node = child(node, i);
+  }
+  if (node->count == kSlots) {
+    split(node);
+    if (i > node->count) {
+      i -= node->count + 1;
+      node = child(node->parent, node->position + 1);
+    }
+  }
+  node->emplace_value(i, value);
+  ++size_;
+  return {iterator{node, i}, true};
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::erase(iterator pos) {
+  node_type* node = pos.node_;
+  size_type i = pos.position_;
+  if (!node->leaf) {
+    // replace the value with its in-order predecessor taken from a leaf
+    node_type* leaf = child(node, i);
+    while (!leaf->leaf) leaf = child(leaf, leaf->count);
+    node->destroy(i);
+    node->construct(i, std::move(leaf->value(leaf->count - 1)));
+    node = leaf;
+    i = leaf->count - 1;
+  }
+  node->remove_value(i);
+  --size_;
+  rebalance(node);
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::swap(BTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(leftmost_, other.leftmost_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::merge(BTree& other) {
+  if (this == &other) return;
+  BTree rest;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    if (!insert(*it).second) rest.insert(*it);
+  }
+  other.swap(rest);
+};
+
+/* ------------------------------ LOOKUP -------------------------------- */
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::find(const key_type& key) {
+  node_type* node = root_;
+  while (node) {
+    size_type i = lower_bound_in_node(node, key);
+    if (i < node->count && equal_keys(key, node->value(i)))
+      return iterator{node, i};
+    node = node->leaf ? nullptr : child(node, i);
+  }
+  return end();
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::lower_bound(
+    const key_type& key) {
+  iterator result = end();
+  node_type* node = root_;
+  while (node) {
+    size_type i = lower_bound_in_node(node, key);
+    if (i < node->count) {
+      result = iterator{node, i};
+      if (equal_keys(key, node->value(i))) break;
+    }
+    node = node->leaf ? nullptr : child(node, i);
+  }
+  return result;
+};
+
+/* ------------------------------ HELPERS ------------------------------- */
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::node_type* BTree<V, KeyOf>::child(node_type* node,
+                                                            size_type i) {
+  return static_cast<internal_type*>(node)->children[i];
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::size_type BTree<V, KeyOf>::lower_bound_in_node(
+    const node_type* node, const key_type& key) {
+  if constexpr (std::is_arithmetic_v<key_type>) {
+    // branch-free count of the smaller keys, which the compiler vectorizes
+    size_type i{};
+    for (size_type j = 0; j < node->count; ++j)
+      i += KeyOf{}(node->value(j)) < key;
+    return i;
+  } else {
+    size_type low{}, high = node->count;
+    while (low < high) {
+      size_type mid = (low + high) / 2;
+      if (KeyOf{}(node->value(mid)) < key)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return low;
+  }
+};
+
+template <typename V, typename KeyOf>
+bool BTree<V, KeyOf>::equal_keys(const key_type& key, const value_type& value) {
+  return !(key < KeyOf{}(value));
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::node_type* BTree<V, KeyOf>::new_node(bool leaf) {
+  return leaf ? new node_type : new internal_type;
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::delete_node(node_type* node) {
+  for (size_type i = 0; i < node->count; ++i) node->destroy(i);
+  if (node->leaf)
+    delete node;
+  else
+    delete static_cast<internal_type*>(node);
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::delete_subtree(node_type* node) {
+  if (!node->leaf) {
+    for (size_type i = 0; i <= node->count; ++i)
+      delete_subtree(child(node, i));
+  }
+  delete_node(node);
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::node_type* BTree<V, KeyOf>::copy_subtree(
+    const node_type* other, node_type* parent) {
+  node_type* node = new_node(other->leaf);
+  node->parent = parent;
+  node->position = other->position;
+  for (size_type i = 0; i < other->count; ++i) {
+    node->construct(i, other->value(i));
+    ++node->count;
+  }
+  if (!node->leaf) {
+    auto* internal = static_cast<internal_type*>(node);
+    auto* other_internal = static_cast<const internal_type*>(other);
+    for (size_type i = 0; i <= other->count; ++i)
+      internal->children[i] = copy_subtree(other_internal->children[i], node);
+  }
+  return node;
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::reset_edges() {
+  leftmost_ = rightmost_ = root_;
+  while (!leftmost_->leaf) leftmost_ = child(leftmost_, 0);
+  while (!rightmost_->leaf) rightmost_ = child(rightmost_, rightmost_->count);
+};
+
+/* ------------------------- SPLIT / REBALANCE -------------------------- */
+
+// Splits a full node around its median, which moves up into the parent. A
+// full parent is split first, a split of the root grows the tree by a level.
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::split(node_type* node) {
+  if (node == root_) {
+    auto* new_root = static_cast<internal_type*>(new_node(false));
+    new_root->set_child(0, node);
+    root_ = new_root;
+  } else if (node->parent->count == kSlots) {
+    split(node->parent);
+  }
+  auto* parent = static_cast<internal_type*>(node->parent);
+  node_type* sibling = new_node(node->leaf);
+  const size_type mid = kSlots / 2;
+  for (size_type j = mid + 1; j < node->count; ++j) {
+    sibling->construct(j - mid - 1, std::move(node->value(j)));
+    node->destroy(j);
+  }
+  sibling->count = static_cast<std::uint16_t>(node->count - mid - 1);
+  if (!node->leaf) {
+    auto* internal = static_cast<internal_type*>(sibling);
+    for (size_type j = mid + 1; j <= node->count; ++j)
+      internal->set_child(j - mid - 1, child(node, j));
+  }
+  parent->emplace_value(node->position, std::move(node->value(mid)));
+  parent->insert_child(node->position + 1, sibling);
+  node->destroy(mid);
+  node->count = static_cast<std::uint16_t>(mid);
+  if (node == rightmost_) rightmost_ = sibling;
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::rebalance(node_type* node) {
+  while (node != root_ && node->count < kMinSlots) {
+    node_type* parent = node->parent;
+    size_type pos = node->position;
+    node_type* left = pos > 0 ? child(parent, pos - 1) : nullptr;
+    node_type* right = pos < parent->count ? child(parent, pos + 1) : nullptr;
+    if (left && left->count > kMinSlots) {
+      rotate_right(left, node);
+      break;
+    } else if (right && right->count > kMinSlots) {
+      rotate_left(node, right);
+      break;
+    } else if (left) {
+      merge_nodes(left, node);
+    } else {
+      merge_nodes(node, right);
+    }
+    node = parent;
+  }
+  if (!root_->count) {
+    node_type* old_root = root_;
+    if (root_->leaf) {
+      root_ = leftmost_ = rightmost_ = nullptr;
+    } else {
+      root_ = child(root_, 0);
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    delete_node(old_root);
+  }
+};
+
+// Moves the last value of left up into the parent and the separator down
+// into the front of node.
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::rotate_right(node_type* left, node_type* node) {
+  node_type* parent = node->parent;
+  size_type sep = left->position;
+  node->emplace_value(0, std::move(parent->value(sep)));
+  if (!node->leaf)
+    static_cast<internal_type*>(node)->insert_child(0,
+                                                    child(left, left->count));
+  parent->destroy(sep);
+  parent->construct(sep, std::move(left->value(left->count - 1)));
+  left->remove_value(left->count - 1);
+};
+
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::rotate_left(node_type* node, node_type* right) {
+  node_type* parent = node->parent;
+  size_type sep = node->position;
+  node->emplace_value(node->count, std::move(parent->value(sep)));
+  if (!node->leaf) {
+    static_cast<internal_type*>(node)->set_child(node->count, child(right, 0));
+    static_cast<internal_type*>(right)->remove_child(0);
+  }
+  parent->destroy(sep);
+  parent->construct(sep, std::move(right->value(0)));
+  right->remove_value(0);
+};
+
+// Appends the separator and the whole right sibling to left and frees right.
+template <typename V, typename KeyOf>
+void BTree<V, KeyOf>::merge_nodes(node_type* left, node_type* right) {
+  auto* parent = static_cast<internal_type*>(left->parent);
+  size_type sep = left->position;
+  left->emplace_value(left->count, std::move(parent->value(sep)));
+  size_type offset = left->count;
+  for (size_type j = 0; j < right->count; ++j)
+    left->emplace_value(left->count, std::move(right->value(j)));
+  if (!left->leaf) {
+    auto* internal = static_cast<internal_type*>(left);
+    for (size_type j = 0; j <= right->count; ++j)
+      internal->set_child(offset + j, child(right, j));
+  }
+  if (right == rightmost_) rightmost_ = left;
+  parent->remove_child(sep + 1);
+  parent->remove_value(sep);
+  delete_node(right);
+};
+
+/* ----------------------------- ITERATOR ------------------------------- */
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::Iterator::Iterator() : node_{}, position_{} {};
+
+template <typename V, typename KeyOf>
+BTree<V, KeyOf>::Iterator::Iterator(node_type* node, size_type position)
+    : node_{node}, position_{position} {};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator& BTree<V, KeyOf>::Iterator::operator++() {
+  if (!node_->leaf) {
+    node_ = child(node_, position_ + 1);
+    while (!node_->leaf) node_ = child(node_, 0);
+    position_ = 0;
+  } else if (++position_ == node_->count) {
+    node_type* last = node_;
+    while (node_->parent && position_ == node_->count) {
+      position_ = node_->position;
+      node_ = node_->parent;
+    }
+    // climbed past the last value: end() stays on the rightmost leaf
+    if (position_ == node_->count) {
+      node_ = last;
+      position_ = last->count;
+    }
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::Iterator::operator++(int) {
+  iterator tmp = *this;
+  operator++();
+  return tmp;
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator& BTree<V, KeyOf>::Iterator::operator--() {
+  if (!node_->leaf) {
+    node_ = child(node_, position_);
+    while (!node_->leaf) node_ = child(node_, node_->count);
+    position_ = node_->count - 1;
+  } else {
+    while (node_->parent && !position_) {
+      position_ = node_->position;
+      node_ = node_->parent;
+    }
+    --position_;
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+typename BTree<V, KeyOf>::iterator BTree<V, KeyOf>::Iterator::operator--(int) {
+  iterator tmp = *this;
+  operator--();
+  return tmp;
+};
+
+template <typename V, typename KeyOf>
+bool BTree<V, KeyOf>::Iterator::operator==(const iterator& it) const {
+  return node_ == it.node_ && position_ == it.position_;
+};
+
+template <typename V, typename KeyOf>
+bool BTree<V, KeyOf>::Iterator::operator!=(const iterator& it) const {
+  return !(*this == it);
+};
+
+template <typename V, typename KeyOf>
+V& BTree<V, KeyOf>::Iterator::operator*() const {
+  return node_->value(position_);
+};
+
+template <typename V, typename KeyOf>
+V* BTree<V, KeyOf>::Iterator::operator->() const {
+  return &node_->value(position_);
+};
+
+template <typename V, typename KeyOf>
+const V& BTree<V, KeyOf>::ConstIterator::operator*() const {
+  return Iterator::operator*();
+};
+
+template <typename V, typename KeyOf>
+const V* BTree<V, KeyOf>::ConstIterator::operator->() const {
+  return Iterator::operator->();
+};
+
+};  // namespace s21
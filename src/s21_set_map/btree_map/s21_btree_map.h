@@ -0,0 +1,61 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_MAP_S21_BTREE_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_MAP_S21_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../btree/s21_btree.h"
+
+namespace s21 {
+
+template <typename Key, typename T>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename BTree<value_type, MapKeyOf<value_type>>::Iterator;
+  using const_iterator =
+      typename BTree<value_type, MapKeyOf<value_type>>::ConstIterator;
+  using size_type = size_t;
+
+  btree_map();
+  btree_map(std::initializer_list<value_type> const &items);
+  btree_map(const btree_map &m);
+  btree_map(btree_map &&m);
+  ~btree_map(){};
+  btree_map &operator=(const btree_map &m);
+  btree_map &operator=(btree_map &&m);
+
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  void erase(iterator pos);
+  void swap(btree_map &other);
+  void merge(btree_map &other);
+
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+
+ private:
+  BTree<value_type, MapKeyOf<value_type>> tree_;
+};
+};  // namespace s21
+
+#include "s21_btree_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_MAP_S21_BTREE_MAP_H_
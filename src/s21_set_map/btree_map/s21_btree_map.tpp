@@ -0,0 +1,136 @@
+namespace s21 {
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type>::btree_map() : tree_{} {};
+
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type>::btree_map(
+    std::initializer_list<value_type> const &items)
+    : tree_{} {
+  for (const auto &item : items) tree_.insert(item);
+};
+
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type>::btree_map(const btree_map &m)
+    : tree_{m.tree_} {};
+
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type>::btree_map(btree_map &&m)
+    : tree_{std::move(m.tree_)} {};
+
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type> &btree_map<key_type, mapped_type>::operator=(
+    const btree_map &m) {
+  tree_ = m.tree_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+btree_map<key_type, mapped_type> &btree_map<key_type, mapped_type>::operator=(
+    btree_map &&m) {
+  tree_ = std::move(m.tree_);
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+mapped_type &btree_map<key_type, mapped_type>::at(const key_type &key) {
+  auto it = tree_.find(key);
+  if (it == tree_.end())
+    throw std::out_of_range("Map dosen't contain this elem!");
+  return (*it).second;
+};
+
+template <typename key_type, typename mapped_type>
+mapped_type &btree_map<key_type, mapped_type>::operator[](
+    const key_type &key) {
+  auto it = tree_.find(key);
+  if (it == tree_.end())
+    it = tree_.insert(value_type{key, mapped_type{}}).first;
+  return (*it).second;
+}
+
+template <typename key_type, typename mapped_type>
+typename btree_map<key_type, mapped_type>::iterator
+btree_map<key_type, mapped_type>::begin() {
+  return tree_.begin();
+};
+
+template <typename key_type, typename mapped_type>
+typename btree_map<key_type, mapped_type>::iterator
+btree_map<key_type, mapped_type>::end() {
+  return tree_.end();
+};
+
+template <typename key_type, typename mapped_type>
+bool btree_map<key_type, mapped_type>::empty() {
+  return tree_.empty();
+};
+
+template <typename key_type, typename mapped_type>
+typename btree_map<key_type, mapped_type>::size_type
+btree_map<key_type, mapped_type>::size() {
+  return tree_.get_size();
+};
+
+template <typename key_type, typename mapped_type>
+typename btree_map<key_type, mapped_type>::size_type
+btree_map<key_type, mapped_type>::max_size() {
+  return tree_.max_size();
+};
+
+template <typename key_type, typename mapped_type>
+void btree_map<key_type, mapped_type>::clear() {
+  tree_.clear();
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename btree_map<key_type, mapped_type>::iterator, bool>
+btree_map<key_type, mapped_type>::insert(const value_type &value) {
+  return tree_.insert(value);
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename btree_map<key_type, mapped_type>::iterator, bool>
+btree_map<key_type, mapped_type>::insert(const key_type &key,
+                                         const mapped_type &obj) {
+  return tree_.insert(value_type{key, obj});
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename btree_map<key_type, mapped_type>::iterator, bool>
+btree_map<key_type, mapped_type>::insert_or_assign(const key_type &key,
+                                                   const mapped_type &obj) {
+  auto it = tree_.find(key);
+  if (it != tree_.end()) {
+    (*it).second = obj;
+    return std::pair<iterator, bool>{it, false};
+  }
+  return tree_.insert(value_type{key, obj});
+}
+
+template <typename key_type, typename mapped_type>
+void btree_map<key_type, mapped_type>::erase(iterator pos) {
+  tree_.erase(pos);
+};
+
+template <typename key_type, typename mapped_type>
+void btree_map<key_type, mapped_type>::swap(btree_map &other) {
+  tree_.swap(other.tree_);
+};
+
+template <typename key_type, typename mapped_type>
+void btree_map<key_type, mapped_type>::merge(btree_map &other) {
+  tree_.merge(other.tree_);
+};
+
+template <typename key_type, typename mapped_type>
+typename btree_map<key_type, mapped_type>::iterator
+btree_map<key_type, mapped_type>::find(const key_type &key) {
+  return tree_.find(key);
+};
+
+template <typename key_type, typename mapped_type>
+bool btree_map<key_type, mapped_type>::contains(const key_type &key) {
+  return tree_.find(key) != tree_.end();
+};
+
+}  // namespace s21
@@ -0,0 +1,53 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_SET_S21_BTREE_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_SET_S21_BTREE_SET_H_
+
+#include <initializer_list>
+
+#include "../btree/s21_btree.h"
+
+namespace s21 {
+template <typename Key>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename BTree<value_type, SetKeyOf<value_type>>::Iterator;
+  using const_iterator =
+      typename BTree<value_type, SetKeyOf<value_type>>::ConstIterator;
+  using size_type = size_t;
+
+  btree_set();
+  btree_set(std::initializer_list<value_type> const &items);
+  btree_set(const btree_set &s);
+  btree_set(btree_set &&s);
+  ~btree_set(){};
+
+  btree_set &operator=(const btree_set &s);
+  btree_set &operator=(btree_set &&s);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  void swap(btree_set &other);
+  void merge(btree_set &other);
+
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+
+ private:
+  BTree<value_type, SetKeyOf<value_type>> tree_;
+};
+};  // namespace s21
+
+#include "s21_btree_set.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_BTREE_SET_S21_BTREE_SET_H_
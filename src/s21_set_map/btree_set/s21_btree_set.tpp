@@ -0,0 +1,105 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type>
+btree_set<value_type>::btree_set() : tree_{} {};
+
+template <typename value_type>
+btree_set<value_type>::btree_set(
+    std::initializer_list<value_type> const &items)
+    : tree_{} {
+  for (const auto &item : items) tree_.insert(item);
+};
+
+template <typename value_type>
+btree_set<value_type>::btree_set(const btree_set &s) : tree_{s.tree_} {};
+
+template <typename value_type>
+btree_set<value_type>::btree_set(btree_set &&s) : tree_{std::move(s.tree_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type>
+btree_set<value_type> &btree_set<value_type>::operator=(const btree_set &s) {
+  tree_ = s.tree_;
+  return *this;
+};
+
+template <typename value_type>
+btree_set<value_type> &btree_set<value_type>::operator=(btree_set &&s) {
+  tree_ = std::move(s.tree_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type>
+typename btree_set<value_type>::iterator btree_set<value_type>::begin() {
+  return tree_.begin();
+};
+
+template <typename value_type>
+typename btree_set<value_type>::iterator btree_set<value_type>::end() {
+  return tree_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type>
+bool btree_set<value_type>::empty() {
+  return tree_.empty();
+};
+
+template <typename value_type>
+typename btree_set<value_type>::size_type btree_set<value_type>::size() {
+  return tree_.get_size();
+};
+
+template <typename value_type>
+typename btree_set<value_type>::size_type btree_set<value_type>::max_size() {
+  return tree_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type>
+void btree_set<value_type>::clear() {
+  tree_.clear();
+};
+
+template <typename value_type>
+std::pair<typename btree_set<value_type>::iterator, bool>
+btree_set<value_type>::insert(const value_type &value) {
+  return tree_.insert(value);
+};
+
+template <typename value_type>
+void btree_set<value_type>::erase(iterator pos) {
+  tree_.erase(pos);
+};
+
+template <typename value_type>
+void btree_set<value_type>::swap(btree_set &other) {
+  tree_.swap(other.tree_);
+};
+
+template <typename value_type>
+void btree_set<value_type>::merge(btree_set &other) {
+  tree_.merge(other.tree_);
+}
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type>
+typename btree_set<value_type>::iterator btree_set<value_type>::find(
+    const key_type &key) {
+  return tree_.find(key);
+};
+
+template <typename value_type>
+bool btree_set<value_type>::contains(const key_type &key) {
+  return tree_.find(key) != tree_.end();
+};
+
+}  // namespace s21
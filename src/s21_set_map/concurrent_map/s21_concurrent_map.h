@@ -0,0 +1,75 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_CONCURRENT_MAP_S21_CONCURRENT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_CONCURRENT_MAP_S21_CONCURRENT_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "../map/s21_map.h"
+
+namespace s21 {
+
+// Map safe to share between threads: keys are spread by hash over Shards
+// independent s21::map instances, each behind its own reader-writer lock, so
+// threads working on different shards never wait for each other. Every call
+// locks a single shard and is atomic with respect to the other calls on the
+// same key. No references into the map are handed out, values are returned
+// by copy or accessed inside the callback of update() and visit().
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          size_t Shards = 64>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+
+  static_assert(Shards > 0, "concurrent_map needs at least one shard");
+
+  concurrent_map();
+  concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &m) = delete;
+  concurrent_map(concurrent_map &&m) = delete;
+  ~concurrent_map(){};
+
+  concurrent_map &operator=(const concurrent_map &m) = delete;
+  concurrent_map &operator=(concurrent_map &&m) = delete;
+
+  bool empty();
+  size_type size();
+
+  void clear();
+  bool insert(const Key &key, const T &obj);
+  bool insert_or_assign(const Key &key, const T &obj);
+  size_type erase(const Key &key);
+  template <typename Fn>
+  bool update(const Key &key, Fn fn);
+
+  std::optional<T> find(const Key &key);
+  bool contains(const Key &key);
+
+  template <typename Fn>
+  void visit(Fn fn);
+
+ private:
+  // own cache line per shard, so that locking one does not invalidate the
+  // mutex of its neighbour
+  struct alignas(64) Shard {
+    std::shared_mutex mutex;
+    map<key_type, mapped_type> data;
+  };
+
+  Shard shards_[Shards];
+  Hash hash_;
+
+  Shard &shard_for(const Key &key);
+};
+};  // namespace s21
+
+#include "s21_concurrent_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_CONCURRENT_MAP_S21_CONCURRENT_MAP_H_
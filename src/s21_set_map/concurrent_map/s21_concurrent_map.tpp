@@ -0,0 +1,152 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+concurrent_map<key_type, mapped_type, Hash, Shards>::concurrent_map()
+    : shards_{}, hash_{} {};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+concurrent_map<key_type, mapped_type, Hash, Shards>::concurrent_map(
+    std::initializer_list<value_type> const &items)
+    : shards_{}, hash_{} {
+  for (const auto &item : items) insert(item.first, item.second);
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+// The shards are checked one after another, the answer is not a snapshot
+// while writers are running.
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+bool concurrent_map<key_type, mapped_type, Hash, Shards>::empty() {
+  for (Shard &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock{shard.mutex};
+    if (!shard.data.empty()) return false;
+  }
+  return true;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+typename concurrent_map<key_type, mapped_type, Hash, Shards>::size_type
+concurrent_map<key_type, mapped_type, Hash, Shards>::size() {
+  size_type size{};
+  for (Shard &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock{shard.mutex};
+    size += shard.data.size();
+  }
+  return size;
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+void concurrent_map<key_type, mapped_type, Hash, Shards>::clear() {
+  for (Shard &shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock{shard.mutex};
+    shard.data.clear();
+  }
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+bool concurrent_map<key_type, mapped_type, Hash, Shards>::insert(
+    const key_type &key, const mapped_type &obj) {
+  Shard &shard = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock{shard.mutex};
+  return shard.data.insert(key, obj).second;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+bool concurrent_map<key_type, mapped_type, Hash, Shards>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  Shard &shard = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock{shard.mutex};
+  return shard.data.insert_or_assign(key, obj).second;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+typename concurrent_map<key_type, mapped_type, Hash, Shards>::size_type
+concurrent_map<key_type, mapped_type, Hash, Shards>::erase(
+    const key_type &key) {
+  Shard &shard = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock{shard.mutex};
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) return 0;
+  shard.data.erase(it);
+  return 1;
+};
+
+// Read-modify-write of a present value: fn(mapped_type &) runs with the shard
+// locked for writing, so it must not call back into the map.
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+template <typename Fn>
+bool concurrent_map<key_type, mapped_type, Hash, Shards>::update(
+    const key_type &key, Fn fn) {
+  Shard &shard = shard_for(key);
+  std::unique_lock<std::shared_mutex> lock{shard.mutex};
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) return false;
+  fn((*it).second);
+  return true;
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+std::optional<mapped_type>
+concurrent_map<key_type, mapped_type, Hash, Shards>::find(const key_type &key) {
+  Shard &shard = shard_for(key);
+  std::shared_lock<std::shared_mutex> lock{shard.mutex};
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) return std::nullopt;
+  return (*it).second;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+bool concurrent_map<key_type, mapped_type, Hash, Shards>::contains(
+    const key_type &key) {
+  Shard &shard = shard_for(key);
+  std::shared_lock<std::shared_mutex> lock{shard.mutex};
+  return shard.data.contains(key);
+};
+
+// Calls fn(const value_type &) for every element, one shard at a time under
+// its read lock: writers are only held back on the shard being visited, and
+// the elements of a shard are seen in key order.
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+template <typename Fn>
+void concurrent_map<key_type, mapped_type, Hash, Shards>::visit(Fn fn) {
+  for (Shard &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock{shard.mutex};
+    for (auto it = shard.data.begin(); it != shard.data.end(); ++it) fn(*it);
+  }
+};
+
+/* ----------------------------- HELPERS ------------------------------ */
+
+// std::hash of integers is the identity, mixed so that strided keys do not
+// pile up on a few shards.
+template <typename key_type, typename mapped_type, typename Hash,
+          size_t Shards>
+typename concurrent_map<key_type, mapped_type, Hash, Shards>::Shard &
+concurrent_map<key_type, mapped_type, Hash, Shards>::shard_for(
+    const key_type &key) {
+  std::uint64_t hash = hash_(key);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return shards_[hash % Shards];
+};
+
+}  // namespace s21
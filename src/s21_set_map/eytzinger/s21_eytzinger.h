@@ -0,0 +1,92 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_EYTZINGER_S21_EYTZINGER_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_EYTZINGER_S21_EYTZINGER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "../tree/s21_key_of.h"
+
+namespace s21 {
+
+// Immutable sorted array in Eytzinger (breadth-first) order: slot 1 holds the
+// root of an implicit search tree and the children of slot k are 2k and
+// 2k + 1. A lookup walks down without branching on the comparison, and the
+// slots a few levels below share a cache line that is prefetched while the
+// current level is compared.
+template <typename V, typename KeyOf>
+class EytzingerArray {
+ public:
+  class ConstIterator;
+
+  using key_type = typename KeyOf::key_type;
+  using value_type = V;
+  using const_reference = const V&;
+  using const_iterator = ConstIterator;
+  using size_type = std::size_t;
+
+  static constexpr size_type kAlignment = 64;
+
+  EytzingerArray() noexcept;
+  template <typename InputIt>
+  EytzingerArray(InputIt first, InputIt last);
+  EytzingerArray(const EytzingerArray& other);
+  EytzingerArray(EytzingerArray&& other) noexcept;
+  ~EytzingerArray();
+
+  EytzingerArray& operator=(const EytzingerArray& other);
+  EytzingerArray& operator=(EytzingerArray&& other) noexcept;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type get_size() const;
+  size_type max_size() const;
+
+  void swap(EytzingerArray& other) noexcept;
+
+  const_iterator find(const key_type& key) const;
+  const_iterator lower_bound(const key_type& key) const;
+  const_iterator upper_bound(const key_type& key) const;
+
+  // Slot 0 is never used, so index 0 is the end of the iteration.
+  class ConstIterator {
+   public:
+    ConstIterator();
+    ConstIterator(const V* slots, size_type size, size_type index);
+
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+    ConstIterator& operator--();
+    ConstIterator operator--(int);
+    bool operator==(const ConstIterator& it) const;
+    bool operator!=(const ConstIterator& it) const;
+    const V& operator*() const;
+    const V* operator->() const;
+
+   private:
+    const V* slots_;
+    size_type size_;
+    size_type index_;
+  };
+
+ private:
+  // slots_[1..size_] hold the values, one allocation aligned to kAlignment
+  V* slots_;
+  size_type size_;
+
+  template <typename Less>
+  size_type search(Less less) const;
+  template <typename InputIt>
+  void build(InputIt& it, const InputIt& last, size_type index);
+  void allocate();
+  void release();
+};
+};  // namespace s21
+
+#include "s21_eytzinger.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_EYTZINGER_S21_EYTZINGER_H_
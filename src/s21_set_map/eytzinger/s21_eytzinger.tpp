@@ -0,0 +1,259 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::EytzingerArray() noexcept : slots_{}, size_{} {};
+
+// The range must be sorted, equal keys after the first one are skipped. It
+// is read twice: once to count the keys and once in order to fill the slots.
+template <typename V, typename KeyOf>
+template <typename InputIt>
+EytzingerArray<V, KeyOf>::EytzingerArray(InputIt first, InputIt last)
+    : EytzingerArray() {
+  if (first == last) return;
+  size_ = 1;
+  for (InputIt prev = first, it = first; ++it != last; prev = it)
+    if (KeyOf{}(*prev) < KeyOf{}(*it)) ++size_;
+  allocate();
+  build(first, last, 1);
+};
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::EytzingerArray(const EytzingerArray& other)
+    : slots_{}, size_{other.size_} {
+  if (!size_) return;
+  allocate();
+  for (size_type i = 1; i <= size_; ++i) new (slots_ + i) V{other.slots_[i]};
+};
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::EytzingerArray(EytzingerArray&& other) noexcept
+    : slots_{other.slots_}, size_{other.size_} {
+  other.slots_ = nullptr;
+  other.size_ = 0;
+};
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::~EytzingerArray() {
+  release();
+};
+
+/* ------------------- OPERATORS --------------------- */
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>& EytzingerArray<V, KeyOf>::operator=(
+    const EytzingerArray& other) {
+  if (this != &other) {
+    EytzingerArray copy{other};
+    swap(copy);
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>& EytzingerArray<V, KeyOf>::operator=(
+    EytzingerArray&& other) noexcept {
+  swap(other);
+  return *this;
+};
+
+/* ------------------- BEGIN / END --------------------- */
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::const_iterator
+EytzingerArray<V, KeyOf>::begin() const {
+  size_type index = size_ ? 1 : 0;
+  while (index && index * 2 <= size_) index *= 2;
+  return const_iterator{slots_, size_, index};
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::const_iterator
+EytzingerArray<V, KeyOf>::end() const {
+  return const_iterator{slots_, size_, 0};
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename V, typename KeyOf>
+bool EytzingerArray<V, KeyOf>::empty() const {
+  return !size_;
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::size_type
+EytzingerArray<V, KeyOf>::get_size() const {
+  return size_;
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::size_type
+EytzingerArray<V, KeyOf>::max_size() const {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(V) - 1;
+};
+
+/* ------------------- MODIFIERS --------------------- */
+
+template <typename V, typename KeyOf>
+void EytzingerArray<V, KeyOf>::swap(EytzingerArray& other) noexcept {
+  std::swap(slots_, other.slots_);
+  std::swap(size_, other.size_);
+};
+
+/* ------------------- LOOKUP --------------------- */
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::const_iterator
+EytzingerArray<V, KeyOf>::find(const key_type& key) const {
+  size_type index = search(
+      [&key](const key_type& other) { return other < key; });
+  if (index && key < KeyOf{}(slots_[index])) index = 0;
+  return const_iterator{slots_, size_, index};
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::const_iterator
+EytzingerArray<V, KeyOf>::lower_bound(const key_type& key) const {
+  size_type index = search(
+      [&key](const key_type& other) { return other < key; });
+  return const_iterator{slots_, size_, index};
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::const_iterator
+EytzingerArray<V, KeyOf>::upper_bound(const key_type& key) const {
+  size_type index = search(
+      [&key](const key_type& other) { return !(key < other); });
+  return const_iterator{slots_, size_, index};
+};
+
+/* ------------------- HELPERS --------------------- */
+
+// Index of the first slot, in sorted order, for which less() is false, or 0.
+// The walk goes right whenever less() holds; the slot where it last went
+// left is recovered from the path bits by dropping the trailing right turns
+// and the final left one.
+template <typename V, typename KeyOf>
+template <typename Less>
+typename EytzingerArray<V, KeyOf>::size_type EytzingerArray<V, KeyOf>::search(
+    Less less) const {
+  constexpr size_type kStride = std::max<size_type>(kAlignment / sizeof(V), 2);
+  size_type index = 1;
+  while (index <= size_) {
+    __builtin_prefetch(slots_ + index * kStride);
+    index = index * 2 + less(KeyOf{}(slots_[index]));
+  }
+  return index >> __builtin_ffsll(~static_cast<long long>(index));
+};
+
+// In-order walk of the implicit tree, consuming the sorted range.
+template <typename V, typename KeyOf>
+template <typename InputIt>
+void EytzingerArray<V, KeyOf>::build(InputIt& it, const InputIt& last,
+                                     size_type index) {
+  if (index > size_) return;
+  build(it, last, index * 2);
+  new (slots_ + index) V{*it};
+  for (++it; it != last && !(KeyOf{}(slots_[index]) < KeyOf{}(*it));) ++it;
+  build(it, last, index * 2 + 1);
+};
+
+template <typename V, typename KeyOf>
+void EytzingerArray<V, KeyOf>::allocate() {
+  slots_ = static_cast<V*>(::operator new(sizeof(V) * (size_ + 1),
+                                          std::align_val_t{kAlignment}));
+};
+
+template <typename V, typename KeyOf>
+void EytzingerArray<V, KeyOf>::release() {
+  if (!slots_) return;
+  for (size_type i = 1; i <= size_; ++i) slots_[i].~V();
+  ::operator delete(slots_, std::align_val_t{kAlignment});
+  slots_ = nullptr;
+  size_ = 0;
+};
+
+/* ------------------- ITERATOR --------------------- */
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::ConstIterator::ConstIterator()
+    : slots_{}, size_{}, index_{} {};
+
+template <typename V, typename KeyOf>
+EytzingerArray<V, KeyOf>::ConstIterator::ConstIterator(const V* slots,
+                                                       size_type size,
+                                                       size_type index)
+    : slots_{slots}, size_{size}, index_{index} {};
+
+// The successor is the leftmost slot of the right subtree, or else the
+// parent of the first ancestor reached from a left child.
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::ConstIterator&
+EytzingerArray<V, KeyOf>::ConstIterator::operator++() {
+  if (index_ * 2 + 1 <= size_) {
+    index_ = index_ * 2 + 1;
+    while (index_ * 2 <= size_) index_ *= 2;
+  } else {
+    while (index_ & 1) index_ >>= 1;
+    index_ >>= 1;
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::ConstIterator
+EytzingerArray<V, KeyOf>::ConstIterator::operator++(int) {
+  ConstIterator tmp = *this;
+  operator++();
+  return tmp;
+};
+
+// From the end this steps to the last slot, the rightmost one.
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::ConstIterator&
+EytzingerArray<V, KeyOf>::ConstIterator::operator--() {
+  if (!index_) {
+    index_ = size_ ? 1 : 0;
+    while (index_ && index_ * 2 + 1 <= size_) index_ = index_ * 2 + 1;
+  } else if (index_ * 2 <= size_) {
+    index_ *= 2;
+    while (index_ * 2 + 1 <= size_) index_ = index_ * 2 + 1;
+  } else {
+    while (!(index_ & 1)) index_ >>= 1;
+    index_ >>= 1;
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+typename EytzingerArray<V, KeyOf>::ConstIterator
+EytzingerArray<V, KeyOf>::ConstIterator::operator--(int) {
+  ConstIterator tmp = *this;
+  operator--();
+  return tmp;
+};
+
+template <typename V, typename KeyOf>
+bool EytzingerArray<V, KeyOf>::ConstIterator::operator==(
+    const ConstIterator& it) const {
+  return index_ == it.index_ && slots_ == it.slots_;
+};
+
+template <typename V, typename KeyOf>
+bool EytzingerArray<V, KeyOf>::ConstIterator::operator!=(
+    const ConstIterator& it) const {
+  return !(*this == it);
+};
+
+template <typename V, typename KeyOf>
+const V& EytzingerArray<V, KeyOf>::ConstIterator::operator*() const {
+  return slots_[index_];
+};
+
+template <typename V, typename KeyOf>
+const V* EytzingerArray<V, KeyOf>::ConstIterator::operator->() const {
+  return slots_ + index_;
+};
+
+};  // namespace s21
@@ -0,0 +1,77 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_MAP_S21_FLAT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_MAP_S21_FLAT_MAP_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_vector/vector/s21_vector.h"
+#include "../map/s21_map.h"
+
+namespace s21 {
+
+// Map kept as a sorted s21::Vector of pairs, see flat_set. The key of the
+// stored pair is not const since elements are shifted by assignment.
+template <typename Key, typename T>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Vector<value_type>::iterator;
+  using const_iterator = typename Vector<value_type>::const_iterator;
+  using size_type = size_t;
+
+  flat_map();
+  flat_map(std::initializer_list<value_type> const &items);
+  explicit flat_map(map<key_type, mapped_type> &m);
+  flat_map(const flat_map &m);
+  flat_map(flat_map &&m);
+  ~flat_map(){};
+  flat_map &operator=(const flat_map &m);
+  flat_map &operator=(flat_map &&m);
+
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  void erase(iterator pos);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+
+  iterator find(const Key &key);
+  iterator lower_bound(const Key &key);
+  bool contains(const Key &key);
+
+ private:
+  Vector<value_type> data_;
+
+  static bool less(const value_type &a, const value_type &b);
+  value_type *first();
+  value_type *last();
+  value_type *lower(const key_type &key);
+  value_type *exact(const key_type &key);
+  void sort_tail(size_type sorted);
+};
+};  // namespace s21
+
+#include "s21_flat_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_MAP_S21_FLAT_MAP_H_
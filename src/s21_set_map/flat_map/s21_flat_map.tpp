@@ -0,0 +1,239 @@
+namespace s21 {
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type>::flat_map() : data_{} {};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type>::flat_map(
+    std::initializer_list<value_type> const &items)
+    : data_{} {
+  insert(items.begin(), items.end());
+};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type>::flat_map(map<key_type, mapped_type> &m)
+    : data_{} {
+  data_.reserve(m.size());
+  for (auto it = m.begin(); it != m.end(); ++it)
+    data_.push_back(value_type{(*it).first, (*it).second});
+};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type>::flat_map(const flat_map &m)
+    : data_{m.data_} {};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type>::flat_map(flat_map &&m)
+    : data_{std::move(m.data_)} {};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type> &flat_map<key_type, mapped_type>::operator=(
+    const flat_map &m) {
+  data_ = m.data_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+flat_map<key_type, mapped_type> &flat_map<key_type, mapped_type>::operator=(
+    flat_map &&m) {
+  data_ = std::move(m.data_);
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+mapped_type &flat_map<key_type, mapped_type>::at(const key_type &key) {
+  value_type *pos = exact(key);
+  if (!pos) throw std::out_of_range("Map dosen't contain this elem!");
+  return pos->second;
+};
+
+template <typename key_type, typename mapped_type>
+mapped_type &flat_map<key_type, mapped_type>::operator[](const key_type &key) {
+  value_type *pos = exact(key);
+  if (!pos) return (*insert(key, mapped_type{}).first).second;
+  return pos->second;
+}
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::iterator
+flat_map<key_type, mapped_type>::begin() {
+  return iterator(first());
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::iterator
+flat_map<key_type, mapped_type>::end() {
+  return iterator(last());
+};
+
+template <typename key_type, typename mapped_type>
+bool flat_map<key_type, mapped_type>::empty() {
+  return data_.empty();
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::size_type
+flat_map<key_type, mapped_type>::size() {
+  return data_.size();
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::size_type
+flat_map<key_type, mapped_type>::max_size() {
+  return data_.max_size();
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::reserve(size_type size) {
+  if (size > data_.capacity()) data_.reserve(size);
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::shrink_to_fit() {
+  data_.shrink_to_fit();
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::clear() {
+  data_.clear();
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename flat_map<key_type, mapped_type>::iterator, bool>
+flat_map<key_type, mapped_type>::insert(const value_type &value) {
+  size_type pos = lower(value.first) - first();
+  if (pos != size() && !(value.first < data_[pos].first))
+    return std::pair<iterator, bool>{iterator(first() + pos), false};
+  data_.push_back(value);
+  std::rotate(first() + pos, last() - 1, last());
+  return std::pair<iterator, bool>{iterator(first() + pos), true};
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename flat_map<key_type, mapped_type>::iterator, bool>
+flat_map<key_type, mapped_type>::insert(const key_type &key,
+                                        const mapped_type &obj) {
+  return insert(value_type{key, obj});
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename flat_map<key_type, mapped_type>::iterator, bool>
+flat_map<key_type, mapped_type>::insert_or_assign(const key_type &key,
+                                                  const mapped_type &obj) {
+  value_type *pos = exact(key);
+  if (pos) {
+    pos->second = obj;
+    return std::pair<iterator, bool>{iterator(pos), false};
+  }
+  return insert(value_type{key, obj});
+}
+
+template <typename key_type, typename mapped_type>
+template <typename InputIt>
+void flat_map<key_type, mapped_type>::insert(InputIt first, InputIt last) {
+  size_type sorted = size();
+  for (; first != last; ++first) data_.push_back(*first);
+  sort_tail(sorted);
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::erase(iterator pos) {
+  std::move(&*pos + 1, last(), &*pos);
+  data_.pop_back();
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::swap(flat_map &other) {
+  data_.swap(other.data_);
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::merge(flat_map &other) {
+  if (this == &other) return;
+  Vector<value_type> merged, rest;
+  merged.reserve(size() + other.size());
+  value_type *a = first(), *a_end = last();
+  value_type *b = other.first(), *b_end = other.last();
+  while (a != a_end && b != b_end) {
+    if (less(*a, *b)) {
+      merged.push_back(*a++);
+    } else if (less(*b, *a)) {
+      merged.push_back(*b++);
+    } else {
+      merged.push_back(*a++);
+      rest.push_back(*b++);
+    }
+  }
+  for (; a != a_end; ++a) merged.push_back(*a);
+  for (; b != b_end; ++b) merged.push_back(*b);
+  data_.swap(merged);
+  other.data_.swap(rest);
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::iterator
+flat_map<key_type, mapped_type>::find(const key_type &key) {
+  value_type *pos = exact(key);
+  return iterator(pos ? pos : last());
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::iterator
+flat_map<key_type, mapped_type>::lower_bound(const key_type &key) {
+  return iterator(lower(key));
+};
+
+template <typename key_type, typename mapped_type>
+bool flat_map<key_type, mapped_type>::contains(const key_type &key) {
+  return exact(key);
+};
+
+/* ----------------------------- HELPERS ------------------------------ */
+
+template <typename key_type, typename mapped_type>
+bool flat_map<key_type, mapped_type>::less(const value_type &a,
+                                           const value_type &b) {
+  return a.first < b.first;
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::value_type *
+flat_map<key_type, mapped_type>::first() {
+  return data_.empty() ? nullptr : &data_[0];
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::value_type *
+flat_map<key_type, mapped_type>::last() {
+  return first() + data_.size();
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::value_type *
+flat_map<key_type, mapped_type>::lower(const key_type &key) {
+  auto key_less = [](const value_type &value, const key_type &k) {
+    return value.first < k;
+  };
+  return std::lower_bound(first(), last(), key, key_less);
+};
+
+template <typename key_type, typename mapped_type>
+typename flat_map<key_type, mapped_type>::value_type *
+flat_map<key_type, mapped_type>::exact(const key_type &key) {
+  value_type *pos = lower(key);
+  return pos != last() && !(key < pos->first) ? pos : nullptr;
+};
+
+template <typename key_type, typename mapped_type>
+void flat_map<key_type, mapped_type>::sort_tail(size_type sorted) {
+  value_type *middle = first() + sorted;
+  std::stable_sort(middle, last(), less);
+  std::inplace_merge(first(), middle, last(), less);
+  // stable sorting and merging keeps the first of the equal keys in front
+  auto equal = [](const value_type &a, const value_type &b) {
+    return !less(a, b);
+  };
+  value_type *unique_end = std::unique(first(), last(), equal);
+  while (last() != unique_end) data_.pop_back();
+};
+
+}  // namespace s21
@@ -0,0 +1,70 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_SET_S21_FLAT_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_SET_S21_FLAT_SET_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+
+#include "../../s21_vector/vector/s21_vector.h"
+#include "../set/s21_set.h"
+
+namespace s21 {
+
+// Set kept as a sorted s21::Vector: no per-element pointers and lookups are
+// binary searches over contiguous memory. Inserting or erasing a single
+// element shifts the tail, so bulk insert(first, last) should be preferred.
+template <typename Key>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Vector<value_type>::iterator;
+  using const_iterator = typename Vector<value_type>::const_iterator;
+  using size_type = size_t;
+
+  flat_set();
+  flat_set(std::initializer_list<value_type> const &items);
+  explicit flat_set(set<value_type> &s);
+  flat_set(const flat_set &s);
+  flat_set(flat_set &&s);
+  ~flat_set(){};
+
+  flat_set &operator=(const flat_set &s);
+  flat_set &operator=(flat_set &&s);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  void erase(iterator pos);
+  void swap(flat_set &other);
+  void merge(flat_set &other);
+
+  iterator find(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  bool contains(const key_type &key);
+
+ private:
+  Vector<value_type> data_;
+
+  value_type *first();
+  value_type *last();
+  value_type *lower(const key_type &key);
+  void sort_tail(size_type sorted);
+};
+};  // namespace s21
+
+#include "s21_flat_set.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FLAT_SET_S21_FLAT_SET_H_
@@ -0,0 +1,194 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type>
+flat_set<value_type>::flat_set() : data_{} {};
+
+template <typename value_type>
+flat_set<value_type>::flat_set(std::initializer_list<value_type> const &items)
+    : data_{} {
+  insert(items.begin(), items.end());
+};
+
+template <typename value_type>
+flat_set<value_type>::flat_set(set<value_type> &s) : data_{} {
+  data_.reserve(s.size());
+  for (auto it = s.begin(); it != s.end(); ++it) data_.push_back(*it);
+};
+
+template <typename value_type>
+flat_set<value_type>::flat_set(const flat_set &s) : data_{s.data_} {};
+
+template <typename value_type>
+flat_set<value_type>::flat_set(flat_set &&s) : data_{std::move(s.data_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type>
+flat_set<value_type> &flat_set<value_type>::operator=(const flat_set &s) {
+  data_ = s.data_;
+  return *this;
+};
+
+template <typename value_type>
+flat_set<value_type> &flat_set<value_type>::operator=(flat_set &&s) {
+  data_ = std::move(s.data_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type>
+typename flat_set<value_type>::iterator flat_set<value_type>::begin() {
+  return iterator(first());
+};
+
+template <typename value_type>
+typename flat_set<value_type>::iterator flat_set<value_type>::end() {
+  return iterator(last());
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type>
+bool flat_set<value_type>::empty() {
+  return data_.empty();
+};
+
+template <typename value_type>
+typename flat_set<value_type>::size_type flat_set<value_type>::size() {
+  return data_.size();
+};
+
+template <typename value_type>
+typename flat_set<value_type>::size_type flat_set<value_type>::max_size() {
+  return data_.max_size();
+};
+
+template <typename value_type>
+void flat_set<value_type>::reserve(size_type size) {
+  if (size > data_.capacity()) data_.reserve(size);
+};
+
+template <typename value_type>
+void flat_set<value_type>::shrink_to_fit() {
+  data_.shrink_to_fit();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type>
+void flat_set<value_type>::clear() {
+  data_.clear();
+};
+
+template <typename value_type>
+std::pair<typename flat_set<value_type>::iterator, bool>
+flat_set<value_type>::insert(const value_type &value) {
+  size_type pos = lower(value) - first();
+  if (pos != size() && !(value < data_[pos]))
+    return std::pair<iterator, bool>{iterator(first() + pos), false};
+  data_.push_back(value);
+  std::rotate(first() + pos, last() - 1, last());
+  return std::pair<iterator, bool>{iterator(first() + pos), true};
+};
+
+// Appends the whole range, then sorts and merges it in once instead of
+// shifting the tail for every element.
+template <typename value_type>
+template <typename InputIt>
+void flat_set<value_type>::insert(InputIt first, InputIt last) {
+  size_type sorted = size();
+  for (; first != last; ++first) data_.push_back(*first);
+  sort_tail(sorted);
+};
+
+template <typename value_type>
+void flat_set<value_type>::erase(iterator pos) {
+  std::move(&*pos + 1, last(), &*pos);
+  data_.pop_back();
+};
+
+template <typename value_type>
+void flat_set<value_type>::swap(flat_set &other) {
+  data_.swap(other.data_);
+};
+
+// Linear merge of both sorted arrays, the keys already present here stay in
+// other.
+template <typename value_type>
+void flat_set<value_type>::merge(flat_set &other) {
+  if (this == &other) return;
+  Vector<value_type> merged, rest;
+  merged.reserve(size() + other.size());
+  value_type *a = first(), *a_end = last();
+  value_type *b = other.first(), *b_end = other.last();
+  while (a != a_end && b != b_end) {
+    if (*a < *b) {
+      merged.push_back(*a++);
+    } else if (*b < *a) {
+      merged.push_back(*b++);
+    } else {
+      merged.push_back(*a++);
+      rest.push_back(*b++);
+    }
+  }
+  for (; a != a_end; ++a) merged.push_back(*a);
+  for (; b != b_end; ++b) merged.push_back(*b);
+  data_.swap(merged);
+  other.data_.swap(rest);
+}
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type>
+typename flat_set<value_type>::iterator flat_set<value_type>::find(
+    const key_type &key) {
+  value_type *pos = lower(key);
+  return iterator(pos != last() && !(key < *pos) ? pos : last());
+};
+
+template <typename value_type>
+typename flat_set<value_type>::iterator flat_set<value_type>::lower_bound(
+    const key_type &key) {
+  return iterator(lower(key));
+};
+
+template <typename value_type>
+bool flat_set<value_type>::contains(const key_type &key) {
+  value_type *pos = lower(key);
+  return pos != last() && !(key < *pos);
+};
+
+/* ----------------------------- HELPERS ------------------------------ */
+
+template <typename value_type>
+value_type *flat_set<value_type>::first() {
+  return data_.empty() ? nullptr : &data_[0];
+};
+
+template <typename value_type>
+value_type *flat_set<value_type>::last() {
+  return first() + data_.size();
+};
+
+template <typename value_type>
+value_type *flat_set<value_type>::lower(const key_type &key) {
+  return std::lower_bound(first(), last(), key);
+};
+
+template <typename value_type>
+void flat_set<value_type>::sort_tail(size_type sorted) {
+  value_type *middle = first() + sorted;
+  std::stable_sort(middle, last());
+  std::inplace_merge(first(), middle, last());
+  // stable sorting and merging keeps the first of the equal keys in front
+  auto equal = [](const value_type &a, const value_type &b) {
+    return !(a < b);
+  };
+  value_type *unique_end = std::unique(first(), last(), equal);
+  while (last() != unique_end) data_.pop_back();
+};
+
+}  // namespace s21
@@ -0,0 +1,58 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_MAP_S21_FROZEN_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_MAP_S21_FROZEN_MAP_H_
+
+#include <stdexcept>
+#include <utility>
+
+#include "../eytzinger/s21_eytzinger.h"
+#include "../map/s21_map.h"
+
+namespace s21 {
+
+// Read-only map, see frozen_set.
+template <typename Key, typename T>
+class frozen_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using const_reference = const value_type &;
+  using array_type = EytzingerArray<value_type, MapKeyOf<value_type>>;
+  using iterator = typename array_type::ConstIterator;
+  using const_iterator = typename array_type::ConstIterator;
+  using size_type = size_t;
+
+  frozen_map();
+  explicit frozen_map(map<key_type, mapped_type> &m);
+  template <typename InputIt>
+  frozen_map(InputIt first, InputIt last);
+  frozen_map(const frozen_map &m);
+  frozen_map(frozen_map &&m);
+  ~frozen_map(){};
+  frozen_map &operator=(const frozen_map &m);
+  frozen_map &operator=(frozen_map &&m);
+
+  const T &at(const Key &key) const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void swap(frozen_map &other);
+
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  const_iterator lower_bound(const Key &key) const;
+  const_iterator upper_bound(const Key &key) const;
+
+ private:
+  array_type array_;
+};
+};  // namespace s21
+
+#include "s21_frozen_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_MAP_S21_FROZEN_MAP_H_
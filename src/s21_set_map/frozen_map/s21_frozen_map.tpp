@@ -0,0 +1,116 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type>::frozen_map() : array_{} {};
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type>::frozen_map(map<key_type, mapped_type> &m)
+    : array_{m.begin(), m.end()} {};
+
+// The range must be sorted by key, pairs with a key seen before are dropped.
+template <typename key_type, typename mapped_type>
+template <typename InputIt>
+frozen_map<key_type, mapped_type>::frozen_map(InputIt first, InputIt last)
+    : array_{first, last} {};
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type>::frozen_map(const frozen_map &m)
+    : array_{m.array_} {};
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type>::frozen_map(frozen_map &&m)
+    : array_{std::move(m.array_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type> &frozen_map<key_type, mapped_type>::operator=(
+    const frozen_map &m) {
+  array_ = m.array_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+frozen_map<key_type, mapped_type> &frozen_map<key_type, mapped_type>::operator=(
+    frozen_map &&m) {
+  array_ = std::move(m.array_);
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+const mapped_type &frozen_map<key_type, mapped_type>::at(
+    const key_type &key) const {
+  const_iterator it = array_.find(key);
+  if (it == array_.end())
+    throw std::out_of_range("Map dosen't contain this elem!");
+  return it->second;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::const_iterator
+frozen_map<key_type, mapped_type>::begin() const {
+  return array_.begin();
+};
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::const_iterator
+frozen_map<key_type, mapped_type>::end() const {
+  return array_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename key_type, typename mapped_type>
+bool frozen_map<key_type, mapped_type>::empty() const {
+  return array_.empty();
+};
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::size_type
+frozen_map<key_type, mapped_type>::size() const {
+  return array_.get_size();
+};
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::size_type
+frozen_map<key_type, mapped_type>::max_size() const {
+  return array_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename key_type, typename mapped_type>
+void frozen_map<key_type, mapped_type>::swap(frozen_map &other) {
+  array_.swap(other.array_);
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::const_iterator
+frozen_map<key_type, mapped_type>::find(const key_type &key) const {
+  return array_.find(key);
+};
+
+template <typename key_type, typename mapped_type>
+bool frozen_map<key_type, mapped_type>::contains(const key_type &key) const {
+  return array_.find(key) != array_.end();
+};
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::const_iterator
+frozen_map<key_type, mapped_type>::lower_bound(const key_type &key) const {
+  return array_.lower_bound(key);
+};
+
+template <typename key_type, typename mapped_type>
+typename frozen_map<key_type, mapped_type>::const_iterator
+frozen_map<key_type, mapped_type>::upper_bound(const key_type &key) const {
+  return array_.upper_bound(key);
+};
+
+}  // namespace s21
@@ -0,0 +1,56 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_SET_S21_FROZEN_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_SET_S21_FROZEN_SET_H_
+
+#include <utility>
+
+#include "../eytzinger/s21_eytzinger.h"
+#include "../set/s21_set.h"
+
+namespace s21 {
+
+// Read-only set for lookup heavy use, built once from a set or a sorted
+// range and stored as an EytzingerArray.
+template <typename Key>
+class frozen_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using const_reference = const value_type &;
+  using array_type = EytzingerArray<value_type, SetKeyOf<value_type>>;
+  using iterator = typename array_type::ConstIterator;
+  using const_iterator = typename array_type::ConstIterator;
+  using size_type = size_t;
+
+  frozen_set();
+  explicit frozen_set(set<value_type> &s);
+  template <typename InputIt>
+  frozen_set(InputIt first, InputIt last);
+  frozen_set(const frozen_set &s);
+  frozen_set(frozen_set &&s);
+  ~frozen_set(){};
+
+  frozen_set &operator=(const frozen_set &s);
+  frozen_set &operator=(frozen_set &&s);
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void swap(frozen_set &other);
+
+  const_iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  const_iterator lower_bound(const key_type &key) const;
+  const_iterator upper_bound(const key_type &key) const;
+
+ private:
+  array_type array_;
+};
+};  // namespace s21
+
+#include "s21_frozen_set.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_FROZEN_SET_S21_FROZEN_SET_H_
@@ -0,0 +1,105 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type>
+frozen_set<value_type>::frozen_set() : array_{} {};
+
+template <typename value_type>
+frozen_set<value_type>::frozen_set(set<value_type> &s)
+    : array_{s.begin(), s.end()} {};
+
+// The range must be sorted, equal keys after the first one are dropped.
+template <typename value_type>
+template <typename InputIt>
+frozen_set<value_type>::frozen_set(InputIt first, InputIt last)
+    : array_{first, last} {};
+
+template <typename value_type>
+frozen_set<value_type>::frozen_set(const frozen_set &s) : array_{s.array_} {};
+
+template <typename value_type>
+frozen_set<value_type>::frozen_set(frozen_set &&s)
+    : array_{std::move(s.array_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type>
+frozen_set<value_type> &frozen_set<value_type>::operator=(
+    const frozen_set &s) {
+  array_ = s.array_;
+  return *this;
+};
+
+template <typename value_type>
+frozen_set<value_type> &frozen_set<value_type>::operator=(frozen_set &&s) {
+  array_ = std::move(s.array_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type>
+typename frozen_set<value_type>::const_iterator
+frozen_set<value_type>::begin() const {
+  return array_.begin();
+};
+
+template <typename value_type>
+typename frozen_set<value_type>::const_iterator
+frozen_set<value_type>::end() const {
+  return array_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type>
+bool frozen_set<value_type>::empty() const {
+  return array_.empty();
+};
+
+template <typename value_type>
+typename frozen_set<value_type>::size_type
+frozen_set<value_type>::size() const {
+  return array_.get_size();
+};
+
+template <typename value_type>
+typename frozen_set<value_type>::size_type
+frozen_set<value_type>::max_size() const {
+  return array_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type>
+void frozen_set<value_type>::swap(frozen_set &other) {
+  array_.swap(other.array_);
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type>
+typename frozen_set<value_type>::const_iterator frozen_set<value_type>::find(
+    const key_type &key) const {
+  return array_.find(key);
+};
+
+template <typename value_type>
+bool frozen_set<value_type>::contains(const key_type &key) const {
+  return array_.find(key) != array_.end();
+};
+
+template <typename value_type>
+typename frozen_set<value_type>::const_iterator
+frozen_set<value_type>::lower_bound(const key_type &key) const {
+  return array_.lower_bound(key);
+};
+
+template <typename value_type>
+typename frozen_set<value_type>::const_iterator
+frozen_set<value_type>::upper_bound(const key_type &key) const {
+  return array_.upper_bound(key);
+};
+
+}  // namespace s21
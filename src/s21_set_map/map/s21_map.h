@@ -1,26 +1,37 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MAP_S21_MAP_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MAP_S21_MAP_H_
 
+#include <string>
+#include <tuple>
 #include <utility>
 
+#include "../bloom_filter/s21_bloom_filter.h"
+#include "../sorted_table/s21_sorted_table.h"
 #include "../tree/s21_avl_tree.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+// Filter is a lookup filter policy over the keys, see set.
+template <typename Key, typename T, typename Filter = NoFilter<Key>>
 class map {
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
-  using node_type = Node<value_type, mapped_type>;
+  using node_type = NodeHandle<value_type>;
   using referensce = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename AvlTree<value_type, mapped_type>::Iterator;
-  using const_iterator =
-      typename AvlTree<value_type, mapped_type>::ConstIterator;
+  using tree_type = AvlTree<value_type, MapKeyOf<value_type>>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
   using size_type = size_t;
 
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
   map();
   map(std::initializer_list<value_type> const &items);
   map(const map &m);
@@ -31,6 +42,7 @@ class map {
 
   T &at(const Key &key);
   T &operator[](const Key &key);
+  T &operator[](Key &&key);
 
   iterator begin();
   iterator end();
@@ -41,16 +53,55 @@ class map {
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
   std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert(const Key &key, T &&obj);
+  insert_return_type insert(node_type &&node);
   std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
-  void erase(iterator pos);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, T &&obj);
+  std::pair<iterator, bool> insert_or_assign(Key &&key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(Key &&key, T &&obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  node_type extract(iterator pos);
+  node_type extract(const Key &key);
+  iterator erase(iterator pos);
+  size_type erase(const Key &key);
+  iterator erase(iterator first, iterator last);
   void swap(map &other);
   void merge(map &other);
 
+  iterator find(const Key &key);
   bool contains(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  template <typename Keys, typename OutputIt>
+  void find_batch(const Keys &keys, OutputIt out);
+  template <typename Keys, typename OutputIt>
+  void contains_batch(const Keys &keys, OutputIt out);
+  template <typename OutputIt>
+  void split(size_type parts, OutputIt out);
+  template <typename Fn>
+  void for_each_in_range(const Key &lo, const Key &hi, Fn fn);
+
+  const Filter &filter() const;
+  void dump_sorted(const std::string &path);
 
  private:
-  AvlTree<value_type, mapped_type> tree_;
+  void refresh_filter();
+  void filter_insert(const Key &key);
+  void filter_erase(size_type count);
+  std::pair<iterator, bool> insert_result(NodeBase *node, const Key &key);
+  template <typename K, typename M>
+  std::pair<iterator, bool> assign_or_emplace(K &&key, M &&obj);
+
+  tree_type tree_;
+  Filter filter_;
 };
 };  // namespace s21
 
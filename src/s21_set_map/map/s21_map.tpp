@@ -1,161 +1,392 @@
 namespace s21 {
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map() : tree_{} {};
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter>::map() : tree_{}, filter_{} {};
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(
-    std::initializer_list<value_type> const &items) {
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter>::map(
+    std::initializer_list<value_type> const &items)
+    : tree_{}, filter_{} {
   for (auto it : items) {
     tree_.insert(it);
   }
+  refresh_filter();
 };
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(const map &m) : tree_{m.tree_} {};
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter>::map(const map &m)
+    : tree_{m.tree_}, filter_{m.filter_} {};
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(map &&m) : tree_{std::move(m.tree_)} {};
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter>::map(map &&m)
+    : tree_{std::move(m.tree_)}, filter_{std::move(m.filter_)} {};
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type> &map<key_type, mapped_type>::operator=(
-    const map &m) {
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter> &
+map<key_type, mapped_type, Filter>::operator=(const map &m) {
   tree_ = m.tree_;
+  filter_ = m.filter_;
   return *this;
 };
 
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type> &map<key_type, mapped_type>::operator=(map &&m) {
+template <typename key_type, typename mapped_type, typename Filter>
+map<key_type, mapped_type, Filter> &
+map<key_type, mapped_type, Filter>::operator=(map &&m) {
   tree_ = std::move(m.tree_);
+  filter_ = std::move(m.filter_);
   return *this;
 };
 
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::at(const key_type &key) {
-  node_type *tmp = tree_.lower_bound(value_type{key, mapped_type{}});
-  if (!tmp || (tmp->value).first != key)
+template <typename key_type, typename mapped_type, typename Filter>
+mapped_type &map<key_type, mapped_type, Filter>::at(const key_type &key) {
+  NodeBase *tmp = tree_.find(key);
+  if (tmp == tree_.end())
     throw std::out_of_range("Map dosen't contain this elem!");
-  return tmp->value.second;
+  return tree_type::value_of(tmp).second;
 };
 
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::operator[](const key_type &key) {
-  node_type *tmp = tree_.lower_bound(value_type{key, mapped_type{}});
-  if (!tmp || (tmp->value).first != key) {
-    auto returned = tree_.insert(value_type{key, mapped_type{}});
-    return returned->value.second;
-  };
-  return tmp->value.second;
+template <typename key_type, typename mapped_type, typename Filter>
+mapped_type &map<key_type, mapped_type, Filter>::operator[](
+    const key_type &key) {
+  NodeBase *tmp = tree_.find(key);
+  if (tmp != tree_.end()) return tree_type::value_of(tmp).second;
+  return (*try_emplace(key).first).second;
 }
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::begin() {
+template <typename key_type, typename mapped_type, typename Filter>
+mapped_type &map<key_type, mapped_type, Filter>::operator[](key_type &&key) {
+  NodeBase *tmp = tree_.find(key);
+  if (tmp != tree_.end()) return tree_type::value_of(tmp).second;
+  return (*try_emplace(std::move(key)).first).second;
+}
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::begin() {
   return iterator{tree_.begin()};
 };
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::end() {
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::end() {
   return iterator{tree_.end()};
 };
 
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::empty() {
+template <typename key_type, typename mapped_type, typename Filter>
+bool map<key_type, mapped_type, Filter>::empty() {
   return tree_.empty();
 };
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::size_type
-map<key_type, mapped_type>::size() {
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::size_type
+map<key_type, mapped_type, Filter>::size() {
   return tree_.get_size();
 };
 
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::size_type
-map<key_type, mapped_type>::max_size() {
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::size_type
+map<key_type, mapped_type, Filter>::max_size() {
   return tree_.max_size();
 };
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::clear() {
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::clear() {
   tree_.clear();
+  filter_.clear();
 };
 
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(const value_type &value) {
-  bool inserted{};
-  node_type *tmp = tree_.lower_bound(value_type{value.first, mapped_type{}});
-  if (!tmp || tmp->value.first != value.first) {
-    inserted = true;
-    tmp = tree_.insert(value);
-  }
-  iterator it{tmp};
-  return std::pair<iterator, bool>{it, inserted};
-};
-
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(const key_type &key,
-                                   const mapped_type &obj) {
-  bool inserted{};
-  node_type *tmp = tree_.lower_bound(value_type{key, mapped_type{}});
-  if (!tmp || tmp->value.first != key) {
-    inserted = true;
-    tmp = tree_.insert(value_type{key, obj});
-  }
-  iterator it{tmp};
-  return std::pair<iterator, bool>{it, inserted};
-};
-
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert_or_assign(const key_type &key,
-                                             const mapped_type &obj) {
-  node_type *tmp = tree_.lower_bound(value_type{key, mapped_type{}});
-  bool inserted{};
-  if (tmp && (tmp->value).first == key) {
-    tmp->value.second = obj;
-  } else {
-    tmp = tree_.insert(value_type{key, obj});
-    inserted = true;
-  }
-  iterator it{tmp};
-  return std::pair<iterator, bool>{it, inserted};
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert(const value_type &value) {
+  NodeBase *tmp = tree_.insert(value);
+  bool inserted = tmp;
+  if (inserted)
+    filter_insert(value.first);
+  else
+    tmp = tree_.find(value.first);
+  return std::pair<iterator, bool>{iterator{tmp}, inserted};
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert(value_type &&value) {
+  return insert_result(tree_.try_emplace(value.first, std::move(value)),
+                       value.first);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert(const key_type &key,
+                                           const mapped_type &obj) {
+  return try_emplace(key, obj);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert(const key_type &key,
+                                           mapped_type &&obj) {
+  return try_emplace(key, std::move(obj));
+};
+
+// The node keeps its allocation, on failure it is handed back with the
+// position of the key that blocked it.
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::insert_return_type
+map<key_type, mapped_type, Filter>::insert(node_type &&node) {
+  if (node.empty()) return insert_return_type{end(), false, node_type{}};
+  NodeBase *tmp = tree_.insert_node(node);
+  if (!tmp) return insert_return_type{find(node.key()), false, std::move(node)};
+  filter_insert(tree_type::value_of(tmp).first);
+  return insert_return_type{iterator{tmp}, true, node_type{}};
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  return assign_or_emplace(key, obj);
+}
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert_or_assign(
+    const key_type &key, mapped_type &&obj) {
+  return assign_or_emplace(key, std::move(obj));
 }
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::erase(iterator pos) {
-  tree_.erase(tree_.lower_bound(*pos));
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert_or_assign(key_type &&key,
+                                                     const mapped_type &obj) {
+  return assign_or_emplace(std::move(key), obj);
+}
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert_or_assign(key_type &&key,
+                                                     mapped_type &&obj) {
+  return assign_or_emplace(std::move(key), std::move(obj));
+}
+
+// Builds the element from args before its key can be compared, so unlike
+// try_emplace it allocates even when the key is present.
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::emplace(Args &&...args) {
+  std::pair<NodeBase *, bool> result =
+      tree_.emplace(std::forward<Args>(args)...);
+  if (result.second) filter_insert(tree_type::value_of(result.first).first);
+  return std::pair<iterator, bool>{iterator{result.first}, result.second};
+};
+
+// Constructs the mapped value from args in place, and only when key is
+// missing: the arguments are neither copied nor moved from otherwise.
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::try_emplace(const key_type &key,
+                                                Args &&...args) {
+  NodeBase *tmp = tree_.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return insert_result(tmp, key);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::try_emplace(key_type &&key,
+                                                Args &&...args) {
+  NodeBase *tmp = tree_.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return insert_result(tmp, key);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::node_type
+map<key_type, mapped_type, Filter>::extract(iterator pos) {
+  node_type node = tree_.extract(pos);
+  filter_erase(1);
+  return node;
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::node_type
+map<key_type, mapped_type, Filter>::extract(const key_type &key) {
+  NodeBase *tmp = tree_.find(key);
+  if (tmp == tree_.end()) return node_type{};
+  return extract(iterator{tmp});
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::erase(iterator pos) {
+  iterator next = tree_.erase(pos);
+  filter_erase(1);
+  return next;
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::size_type
+map<key_type, mapped_type, Filter>::erase(const key_type &key) {
+  NodeBase *node = tree_.find(key);
+  if (node == tree_.end()) return 0;
+  tree_.erase(node);
+  filter_erase(1);
+  return 1;
 };
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::swap(map &other) {
+// O(k + log n): the tree is split around the range instead of unlinking the
+// pairs one by one.
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::erase(iterator first, iterator last) {
+  size_type before = tree_.get_size();
+  iterator next = tree_.erase(first, last);
+  filter_erase(before - tree_.get_size());
+  return next;
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::swap(map &other) {
   std::swap(tree_, other.tree_);
+  std::swap(filter_, other.filter_);
 };
 
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::merge(map &other) {
-  node_type *inserted_node{};
-  for (auto it = other.begin(); it != other.end();) {
-    inserted_node = tree_.lower_bound(value_type{(*it).first, mapped_type{}});
-    if (!inserted_node || inserted_node->value.first != (*it).first) {
-      insert(*it);
-      inserted_node =
-          other.tree_.lower_bound(value_type{(*it).first, mapped_type{}});
-      ++it;
-      if (other.size() == 1) it = iterator{nullptr};
-      other.erase(iterator{inserted_node});
-    } else {
-      ++it;
-    }
-  }
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::merge(map &other) {
+  size_type before = tree_.get_size();
+  tree_.merge(other.tree_);
+  size_type moved = tree_.get_size() - before;
+  if (!moved) return;
+  filter_.invalidate();
+  refresh_filter();
+  other.filter_erase(moved);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::find(const key_type &key) {
+  if (!filter_.may_contain(key)) return end();
+  return iterator{tree_.find(key)};
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+bool map<key_type, mapped_type, Filter>::contains(const key_type &key) {
+  return filter_.may_contain(key) && tree_.find(key) != tree_.end();
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::lower_bound(const key_type &key) {
+  return iterator{tree_.lower_bound(key)};
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+typename map<key_type, mapped_type, Filter>::iterator
+map<key_type, mapped_type, Filter>::upper_bound(const key_type &key) {
+  return iterator{tree_.upper_bound(key)};
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator,
+          typename map<key_type, mapped_type, Filter>::iterator>
+map<key_type, mapped_type, Filter>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>{lower_bound(key), upper_bound(key)};
+};
+
+// Calls fn(value_type &) for the keys in [lo, hi), see set.
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename Fn>
+void map<key_type, mapped_type, Filter>::for_each_in_range(
+    const key_type &lo, const key_type &hi, Fn fn) {
+  if (!(lo < hi)) return;
+  NodeBase *last = tree_.lower_bound(hi);
+  for (NodeBase *node = tree_.lower_bound(lo); node != last;
+       node = node->next_node())
+    fn(tree_type::value_of(node));
+};
+
+// Writes an iterator per key of keys to out, see set.
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename Keys, typename OutputIt>
+void map<key_type, mapped_type, Filter>::find_batch(const Keys &keys,
+                                                    OutputIt out) {
+  tree_.find_batch(keys, [&out](NodeBase *node) { *out++ = iterator{node}; });
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename Keys, typename OutputIt>
+void map<key_type, mapped_type, Filter>::contains_batch(const Keys &keys,
+                                                        OutputIt out) {
+  NodeBase *last = tree_.end();
+  tree_.find_batch(keys,
+                   [&out, last](NodeBase *node) { *out++ = node != last; });
+};
+
+// Cuts the map into ranges of similar sizes, see set.
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename OutputIt>
+void map<key_type, mapped_type, Filter>::split(size_type parts, OutputIt out) {
+  tree_.split(parts, [&out](NodeBase *node) { *out++ = iterator{node}; });
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+const Filter &map<key_type, mapped_type, Filter>::filter() const {
+  return filter_;
+};
+
+// Writes the pairs in key order as a sorted table, for mapped_table to open
+// without rebuilding a tree. Key and T have to be trivially copyable.
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::dump_sorted(const std::string &path) {
+  write_sorted_table<key_type, mapped_type>(path, begin(), end(), size());
+};
+
+// Rebuilds the filter from the keys in the tree once it asks for it, see set.
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::refresh_filter() {
+  if (!filter_.full() && !filter_.stale()) return;
+  filter_.reset(tree_.get_size());
+  for (NodeBase *node = tree_.begin(); node != tree_.end();
+       node = node->next_node())
+    filter_.insert(tree_type::value_of(node).first);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::filter_insert(const key_type &key) {
+  if (filter_.full())
+    refresh_filter();
+  else
+    filter_.insert(key);
+};
+
+template <typename key_type, typename mapped_type, typename Filter>
+void map<key_type, mapped_type, Filter>::filter_erase(size_type count) {
+  filter_.erase(count);
+  refresh_filter();
+};
+
+// Wraps the node an insertion returned, nullptr when key was present.
+template <typename key_type, typename mapped_type, typename Filter>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::insert_result(NodeBase *node,
+                                                  const key_type &key) {
+  if (!node) return std::pair<iterator, bool>{find(key), false};
+  filter_insert(tree_type::value_of(node).first);
+  return std::pair<iterator, bool>{iterator{node}, true};
 };
 
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::contains(const key_type &key) {
-  auto res = tree_.lower_bound(value_type{key, mapped_type{}});
-  return res && (res->value).first == key;
+template <typename key_type, typename mapped_type, typename Filter>
+template <typename K, typename M>
+std::pair<typename map<key_type, mapped_type, Filter>::iterator, bool>
+map<key_type, mapped_type, Filter>::assign_or_emplace(K &&key, M &&obj) {
+  NodeBase *tmp = tree_.find(key);
+  if (tmp == tree_.end())
+    return try_emplace(std::forward<K>(key), std::forward<M>(obj));
+  tree_type::value_of(tmp).second = std::forward<M>(obj);
+  return std::pair<iterator, bool>{iterator{tmp}, false};
 };
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,97 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MAPPED_TABLE_S21_MAPPED_TABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MAPPED_TABLE_S21_MAPPED_TABLE_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../sorted_table/s21_sorted_table.h"
+
+namespace s21 {
+
+// Read-only view of a table written by map::dump_sorted. The file is mapped
+// into memory and searched where it lies, nothing is parsed or copied when
+// it is opened, so the first lookups are only as slow as the pages they
+// touch. Keys and values stay in separate regions, the iterator returns
+// references into both.
+template <typename Key, typename T>
+class mapped_table {
+ public:
+  class ConstIterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type &, const mapped_type &>;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+
+  mapped_table() noexcept;
+  explicit mapped_table(const std::string &path);
+  mapped_table(const mapped_table &) = delete;
+  mapped_table(mapped_table &&other) noexcept;
+  ~mapped_table();
+
+  mapped_table &operator=(const mapped_table &) = delete;
+  mapped_table &operator=(mapped_table &&other) noexcept;
+
+  const T &at(const Key &key) const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+
+  void swap(mapped_table &other) noexcept;
+
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  const_iterator lower_bound(const Key &key) const;
+  const_iterator upper_bound(const Key &key) const;
+
+  class ConstIterator {
+   public:
+    ConstIterator();
+    ConstIterator(const Key *keys, const T *values, size_type index);
+
+    ConstIterator &operator++();
+    ConstIterator operator++(int);
+    ConstIterator &operator--();
+    ConstIterator operator--(int);
+    bool operator==(const ConstIterator &it) const;
+    bool operator!=(const ConstIterator &it) const;
+    value_type operator*() const;
+    const Key &key() const;
+    const T &value() const;
+
+   private:
+    const Key *keys_;
+    const T *values_;
+    size_type index_;
+  };
+
+ private:
+  template <typename Less>
+  size_type search(const Key &key, Less less) const;
+
+  void *data_;
+  size_type file_size_;
+  size_type size_;
+  size_type index_count_;
+  const Key *keys_;
+  const Key *index_;
+  const T *values_;
+};
+};  // namespace s21
+
+#include "s21_mapped_table.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MAPPED_TABLE_S21_MAPPED_TABLE_H_
@@ -0,0 +1,245 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::mapped_table() noexcept
+    : data_{},
+      file_size_{},
+      size_{},
+      index_count_{},
+      keys_{},
+      index_{},
+      values_{} {};
+
+// The header has to match what dump_sorted writes for these types, offset
+// for offset, otherwise the file is refused.
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::mapped_table(const std::string &path)
+    : mapped_table() {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::system_error(errno, std::generic_category(), path);
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), path);
+  }
+  if (static_cast<size_type>(st.st_size) < sizeof(SortedTableHeader)) {
+    ::close(fd);
+    throw std::runtime_error(path + " is not a table of these types");
+  }
+  void *data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  int error = data == MAP_FAILED ? errno : 0;
+  ::close(fd);
+  if (error) throw std::system_error(error, std::generic_category(), path);
+  data_ = data;
+  file_size_ = st.st_size;
+  const SortedTableHeader &header = *static_cast<SortedTableHeader *>(data);
+  SortedTableHeader expected =
+      make_sorted_table_header<key_type, mapped_type>(header.count);
+  if (header.count > file_size_ ||
+      std::memcmp(&header, &expected, sizeof(header)) ||
+      expected.file_size > file_size_) {
+    ::munmap(data_, file_size_);
+    data_ = nullptr;
+    throw std::runtime_error(path + " is not a table of these types");
+  }
+  const char *base = static_cast<const char *>(data);
+  size_ = header.count;
+  index_count_ = header.index_count;
+  keys_ = reinterpret_cast<const key_type *>(base + header.keys_offset);
+  index_ = reinterpret_cast<const key_type *>(base + header.index_offset);
+  values_ =
+      reinterpret_cast<const mapped_type *>(base + header.values_offset);
+};
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::mapped_table(
+    mapped_table &&other) noexcept
+    : mapped_table() {
+  swap(other);
+};
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::~mapped_table() {
+  if (data_) ::munmap(data_, file_size_);
+};
+
+/* ------------------- OPERATORS --------------------- */
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>
+    &mapped_table<key_type, mapped_type>::operator=(
+        mapped_table &&other) noexcept {
+  swap(other);
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+const mapped_type &mapped_table<key_type, mapped_type>::at(
+    const key_type &key) const {
+  const_iterator it = find(key);
+  if (it == end()) throw std::out_of_range("Map dosen't contain this elem!");
+  return it.value();
+};
+
+/* ------------------- BEGIN / END --------------------- */
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::const_iterator
+mapped_table<key_type, mapped_type>::begin() const {
+  return const_iterator{keys_, values_, 0};
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::const_iterator
+mapped_table<key_type, mapped_type>::end() const {
+  return const_iterator{keys_, values_, size_};
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename key_type, typename mapped_type>
+bool mapped_table<key_type, mapped_type>::empty() const {
+  return !size_;
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::size_type
+mapped_table<key_type, mapped_type>::size() const {
+  return size_;
+};
+
+template <typename key_type, typename mapped_type>
+void mapped_table<key_type, mapped_type>::swap(mapped_table &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(file_size_, other.file_size_);
+  std::swap(size_, other.size_);
+  std::swap(index_count_, other.index_count_);
+  std::swap(keys_, other.keys_);
+  std::swap(index_, other.index_);
+  std::swap(values_, other.values_);
+};
+
+/* ------------------- LOOKUP --------------------- */
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::const_iterator
+mapped_table<key_type, mapped_type>::find(const key_type &key) const {
+  const_iterator it = lower_bound(key);
+  if (it == end() || key < it.key()) return end();
+  return it;
+};
+
+template <typename key_type, typename mapped_type>
+bool mapped_table<key_type, mapped_type>::contains(
+    const key_type &key) const {
+  return find(key) != end();
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::const_iterator
+mapped_table<key_type, mapped_type>::lower_bound(const key_type &key) const {
+  size_type index =
+      search(key, [](const key_type &a, const key_type &b) { return a < b; });
+  return const_iterator{keys_, values_, index};
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::const_iterator
+mapped_table<key_type, mapped_type>::upper_bound(const key_type &key) const {
+  size_type index = search(
+      key, [](const key_type &a, const key_type &b) { return !(b < a); });
+  return const_iterator{keys_, values_, index};
+};
+
+// Index of the first key k with !less(k, key). The index narrows the search
+// down to one stride of keys: the answer lies after the last index entry
+// still less than key and at most at the next one.
+template <typename key_type, typename mapped_type>
+template <typename Less>
+typename mapped_table<key_type, mapped_type>::size_type
+mapped_table<key_type, mapped_type>::search(const key_type &key,
+                                            Less less) const {
+  auto pred = [&key, &less](const key_type &k) { return less(k, key); };
+  size_type block =
+      std::partition_point(index_, index_ + index_count_, pred) - index_;
+  if (!block) return 0;
+  size_type first = (block - 1) * kSortedTableStride + 1;
+  size_type last = std::min<size_type>(block * kSortedTableStride, size_);
+  return std::partition_point(keys_ + first, keys_ + last, pred) - keys_;
+};
+
+/* ------------------- ITERATOR --------------------- */
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::ConstIterator::ConstIterator()
+    : keys_{}, values_{}, index_{} {};
+
+template <typename key_type, typename mapped_type>
+mapped_table<key_type, mapped_type>::ConstIterator::ConstIterator(
+    const key_type *keys, const mapped_type *values, size_type index)
+    : keys_{keys}, values_{values}, index_{index} {};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::ConstIterator &
+mapped_table<key_type, mapped_type>::ConstIterator::operator++() {
+  ++index_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::ConstIterator
+mapped_table<key_type, mapped_type>::ConstIterator::operator++(int) {
+  ConstIterator tmp = *this;
+  ++index_;
+  return tmp;
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::ConstIterator &
+mapped_table<key_type, mapped_type>::ConstIterator::operator--() {
+  --index_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::ConstIterator
+mapped_table<key_type, mapped_type>::ConstIterator::operator--(int) {
+  ConstIterator tmp = *this;
+  --index_;
+  return tmp;
+};
+
+template <typename key_type, typename mapped_type>
+bool mapped_table<key_type, mapped_type>::ConstIterator::operator==(
+    const ConstIterator &it) const {
+  return index_ == it.index_ && keys_ == it.keys_;
+};
+
+template <typename key_type, typename mapped_type>
+bool mapped_table<key_type, mapped_type>::ConstIterator::operator!=(
+    const ConstIterator &it) const {
+  return !(*this == it);
+};
+
+template <typename key_type, typename mapped_type>
+typename mapped_table<key_type, mapped_type>::value_type
+mapped_table<key_type, mapped_type>::ConstIterator::operator*() const {
+  return value_type{keys_[index_], values_[index_]};
+};
+
+template <typename key_type, typename mapped_type>
+const key_type &mapped_table<key_type, mapped_type>::ConstIterator::key()
+    const {
+  return keys_[index_];
+};
+
+template <typename key_type, typename mapped_type>
+const mapped_type &
+mapped_table<key_type, mapped_type>::ConstIterator::value() const {
+  return values_[index_];
+};
+
+}  // namespace s21
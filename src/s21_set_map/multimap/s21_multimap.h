@@ -0,0 +1,63 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTIMAP_S21_MULTIMAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTIMAP_S21_MULTIMAP_H_
+
+#include <utility>
+
+#include "../tree/s21_avl_tree.h"
+
+namespace s21 {
+
+// Ordered map that keeps equal keys, in the order they were inserted.
+template <typename Key, typename T>
+class multimap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using node_type = Node<value_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = AvlTree<value_type, MapKeyOf<value_type>>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using size_type = size_t;
+
+  multimap();
+  multimap(std::initializer_list<value_type> const &items);
+  multimap(const multimap &mm);
+  multimap(multimap &&mm);
+  ~multimap(){};
+  multimap &operator=(const multimap &mm);
+  multimap &operator=(multimap &&mm);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  iterator insert(const value_type &value);
+  iterator insert(const Key &key, const T &obj);
+  iterator erase(iterator pos);
+  size_type erase(const Key &key);
+  iterator erase(iterator first, iterator last);
+  void swap(multimap &other);
+  void merge(multimap &other);
+
+  size_type count(const Key &key);
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  std::pair<iterator, iterator> equal_range(const Key &key);
+  iterator lower_bound(const Key &key);
+  iterator upper_bound(const Key &key);
+
+ private:
+  tree_type tree_;
+};
+};  // namespace s21
+
+#include "s21_multimap.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTIMAP_S21_MULTIMAP_H_
@@ -0,0 +1,168 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type>::multimap() : tree_{} {};
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type>::multimap(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) tree_.insert_multi(item);
+};
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type>::multimap(const multimap &mm)
+    : tree_{mm.tree_} {};
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type>::multimap(multimap &&mm)
+    : tree_{std::move(mm.tree_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type> &multimap<key_type, mapped_type>::operator=(
+    const multimap &mm) {
+  tree_ = mm.tree_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+multimap<key_type, mapped_type> &multimap<key_type, mapped_type>::operator=(
+    multimap &&mm) {
+  tree_ = std::move(mm.tree_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::begin() {
+  return iterator{tree_.begin()};
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::end() {
+  return iterator{tree_.end()};
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename key_type, typename mapped_type>
+bool multimap<key_type, mapped_type>::empty() {
+  return tree_.empty();
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::size_type
+multimap<key_type, mapped_type>::size() {
+  return tree_.get_size();
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::size_type
+multimap<key_type, mapped_type>::max_size() {
+  return tree_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename key_type, typename mapped_type>
+void multimap<key_type, mapped_type>::clear() {
+  tree_.clear();
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::insert(const value_type &value) {
+  return iterator{tree_.insert_multi(value)};
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::insert(const key_type &key,
+                                        const mapped_type &obj) {
+  return insert(value_type{key, obj});
+};
+
+// Removes the very element pos points to, not the first one with its key.
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::erase(iterator pos) {
+  return tree_.erase(pos);
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::size_type
+multimap<key_type, mapped_type>::erase(const key_type &key) {
+  return tree_.erase_range(tree_.lower_bound(key), tree_.upper_bound(key));
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::erase(iterator first, iterator last) {
+  return tree_.erase(first, last);
+};
+
+template <typename key_type, typename mapped_type>
+void multimap<key_type, mapped_type>::swap(multimap &other) {
+  std::swap(tree_, other.tree_);
+};
+
+template <typename key_type, typename mapped_type>
+void multimap<key_type, mapped_type>::merge(multimap &other) {
+  if (&other == this) return;
+  for (NodeBase *node = other.tree_.begin(); node != other.tree_.end();
+       node = node->next_node())
+    tree_.insert_multi(tree_type::value_of(node));
+  other.clear();
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::size_type
+multimap<key_type, mapped_type>::count(const key_type &key) {
+  size_type result{};
+  NodeBase *last = tree_.upper_bound(key);
+  for (NodeBase *node = tree_.lower_bound(key); node != last;
+       node = node->next_node())
+    ++result;
+  return result;
+};
+
+// The first of the elements with this key.
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::find(const key_type &key) {
+  return iterator{tree_.find(key)};
+};
+
+template <typename key_type, typename mapped_type>
+bool multimap<key_type, mapped_type>::contains(const key_type &key) {
+  return tree_.find(key) != tree_.end();
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename multimap<key_type, mapped_type>::iterator,
+          typename multimap<key_type, mapped_type>::iterator>
+multimap<key_type, mapped_type>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>{lower_bound(key), upper_bound(key)};
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::lower_bound(const key_type &key) {
+  return iterator{tree_.lower_bound(key)};
+};
+
+template <typename key_type, typename mapped_type>
+typename multimap<key_type, mapped_type>::iterator
+multimap<key_type, mapped_type>::upper_bound(const key_type &key) {
+  return iterator{tree_.upper_bound(key)};
+};
+
+}  // namespace s21
@@ -0,0 +1,62 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTISET_S21_MULTISET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTISET_S21_MULTISET_H_
+
+#include <utility>
+
+#include "../tree/s21_avl_tree.h"
+
+namespace s21 {
+
+// Ordered set that keeps equal keys, in the order they were inserted.
+template <typename Key>
+class multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using node_type = Node<value_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = AvlTree<value_type>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using size_type = size_t;
+
+  multiset();
+  multiset(std::initializer_list<value_type> const &items);
+  multiset(const multiset &ms);
+  multiset(multiset &&ms);
+  ~multiset(){};
+
+  multiset &operator=(const multiset &ms);
+  multiset &operator=(multiset &&ms);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  iterator insert(const value_type &value);
+  iterator erase(iterator pos);
+  size_type erase(const key_type &key);
+  iterator erase(iterator first, iterator last);
+  void swap(multiset &other);
+  void merge(multiset &other);
+
+  size_type count(const key_type &key);
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+
+ private:
+  tree_type tree_;
+};
+};  // namespace s21
+
+#include "s21_multiset.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_MULTISET_S21_MULTISET_H_
@@ -0,0 +1,155 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type>
+multiset<value_type>::multiset() : tree_{} {};
+
+template <typename value_type>
+multiset<value_type>::multiset(std::initializer_list<value_type> const &items)
+    : tree_{} {
+  for (const value_type &item : items) tree_.insert_multi(item);
+};
+
+template <typename value_type>
+multiset<value_type>::multiset(const multiset &ms) : tree_{ms.tree_} {};
+
+template <typename value_type>
+multiset<value_type>::multiset(multiset &&ms) : tree_{std::move(ms.tree_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type>
+multiset<value_type> &multiset<value_type>::operator=(
+    const multiset<value_type> &ms) {
+  tree_ = ms.tree_;
+  return *this;
+};
+
+template <typename value_type>
+multiset<value_type> &multiset<value_type>::operator=(
+    multiset<value_type> &&ms) {
+  tree_ = std::move(ms.tree_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::begin() {
+  return iterator(tree_.begin());
+};
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::end() {
+  return iterator(tree_.end());
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type>
+bool multiset<value_type>::empty() {
+  return tree_.empty();
+};
+
+template <typename value_type>
+typename multiset<value_type>::size_type multiset<value_type>::size() {
+  return tree_.get_size();
+};
+
+template <typename value_type>
+typename multiset<value_type>::size_type multiset<value_type>::max_size() {
+  return tree_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type>
+void multiset<value_type>::clear() {
+  tree_.clear();
+};
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::insert(
+    const value_type &value) {
+  return iterator{tree_.insert_multi(value)};
+};
+
+// Removes the very element pos points to, not the first one equal to it.
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::erase(
+    iterator pos) {
+  return tree_.erase(pos);
+};
+
+template <typename value_type>
+typename multiset<value_type>::size_type multiset<value_type>::erase(
+    const key_type &key) {
+  return tree_.erase_range(tree_.lower_bound(key), tree_.upper_bound(key));
+};
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::erase(
+    iterator first, iterator last) {
+  return tree_.erase(first, last);
+};
+
+template <typename value_type>
+void multiset<value_type>::swap(multiset<value_type> &other) {
+  std::swap(tree_, other.tree_);
+};
+
+template <typename value_type>
+void multiset<value_type>::merge(multiset<value_type> &other) {
+  if (&other == this) return;
+  for (NodeBase *node = other.tree_.begin(); node != other.tree_.end();
+       node = node->next_node())
+    tree_.insert_multi(tree_type::value_of(node));
+  other.clear();
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type>
+typename multiset<value_type>::size_type multiset<value_type>::count(
+    const key_type &key) {
+  size_type result{};
+  NodeBase *last = tree_.upper_bound(key);
+  for (NodeBase *node = tree_.lower_bound(key); node != last;
+       node = node->next_node())
+    ++result;
+  return result;
+};
+
+// The first of the equal keys.
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::find(
+    const key_type &key) {
+  return iterator{tree_.find(key)};
+};
+
+template <typename value_type>
+bool multiset<value_type>::contains(const key_type &key) {
+  return tree_.find(key) != tree_.end();
+};
+
+template <typename value_type>
+std::pair<typename multiset<value_type>::iterator,
+          typename multiset<value_type>::iterator>
+multiset<value_type>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>{lower_bound(key), upper_bound(key)};
+};
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::lower_bound(
+    const key_type &key) {
+  return iterator{tree_.lower_bound(key)};
+};
+
+template <typename value_type>
+typename multiset<value_type>::iterator multiset<value_type>::upper_bound(
+    const key_type &key) {
+  return iterator{tree_.upper_bound(key)};
+};
+
+}  // namespace s21
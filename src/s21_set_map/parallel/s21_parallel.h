@@ -0,0 +1,56 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PARALLEL_S21_PARALLEL_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PARALLEL_S21_PARALLEL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Traversals of a set or map that hand the ranges of Container::split to a
+// pool of threads. The ranges are cut along subtree boundaries, several per
+// thread, and the threads take them one at a time so that an uneven split
+// or a slow element does not hold up the others. The container must not be
+// modified while they run.
+
+// Ranges each thread of the pool takes on average.
+constexpr std::size_t kParallelChunksPerThread = 8;
+
+// Alignment of the per-range results, so that threads storing neighbouring
+// ones do not write to the same cache line.
+constexpr std::size_t kParallelSlotAlign = 64;
+
+inline std::size_t parallel_default_threads();
+
+// Calls task(i) for every i in [0, tasks) on up to threads threads, the
+// calling one included. The first exception thrown by a task is rethrown
+// once all threads are done, the tasks not started by then are skipped.
+template <typename Task>
+void parallel_run(std::size_t tasks, std::size_t threads, Task task);
+
+// Calls fn(element) for every element, fn must be safe to call concurrently.
+template <typename Container, typename Fn>
+void parallel_for_each(Container &container, Fn fn,
+                       std::size_t threads = parallel_default_threads());
+
+// Folds each range into a copy of init with op(T, element) and combines the
+// results in key order with combine(T, T), so init must be the identity of
+// combine and combine associative. The three argument form combines with op,
+// which then has to accept (T, T) as well as (T, element); a fold whose op
+// only takes elements needs an explicit combine.
+template <typename Container, typename T, typename Op, typename Combine>
+T parallel_reduce(Container &container, T init, Op op, Combine combine,
+                  std::size_t threads = parallel_default_threads());
+template <typename Container, typename T, typename Op>
+T parallel_reduce(Container &container, T init, Op op);
+};  // namespace s21
+
+#include "s21_parallel.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PARALLEL_S21_PARALLEL_H_
@@ -0,0 +1,82 @@
+namespace s21 {
+
+inline std::size_t parallel_default_threads() {
+  std::size_t threads = std::thread::hardware_concurrency();
+  return threads ? threads : 1;
+};
+
+template <typename Task>
+void parallel_run(std::size_t tasks, std::size_t threads, Task task) {
+  if (threads > tasks) threads = tasks;
+  if (threads <= 1) {
+    for (std::size_t i = 0; i < tasks; ++i) task(i);
+    return;
+  }
+  std::atomic<std::size_t> next{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto worker = [&] {
+    std::size_t i = next.fetch_add(1);
+    for (; i < tasks; i = next.fetch_add(1)) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock{error_mutex};
+        if (!error) error = std::current_exception();
+        next.store(tasks);
+      }
+    }
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (std::size_t t = 1; t < threads; ++t) pool.emplace_back(worker);
+  worker();
+  for (auto &thread : pool) thread.join();
+  if (error) std::rethrow_exception(error);
+};
+
+template <typename Container, typename Fn>
+void parallel_for_each(Container &container, Fn fn, std::size_t threads) {
+  std::vector<typename Container::iterator> bounds;
+  container.split(threads * kParallelChunksPerThread,
+                  std::back_inserter(bounds));
+  parallel_run(bounds.size() - 1, threads, [&bounds, &fn](std::size_t i) {
+    for (auto it = bounds[i]; it != bounds[i + 1]; ++it) fn(*it);
+  });
+};
+
+template <typename Container, typename T, typename Op, typename Combine>
+T parallel_reduce(Container &container, T init, Op op, Combine combine,
+                  std::size_t threads) {
+  std::vector<typename Container::iterator> bounds;
+  container.split(threads * kParallelChunksPerThread,
+                  std::back_inserter(bounds));
+  struct alignas(kParallelSlotAlign) Slot {
+    T value;
+  };
+  std::vector<Slot> partial(bounds.size() - 1, Slot{init});
+  parallel_run(partial.size(), threads, [&](std::size_t i) {
+    T value = init;
+    for (auto it = bounds[i]; it != bounds[i + 1]; ++it)
+      value = op(std::move(value), *it);
+    partial[i].value = std::move(value);
+  });
+  T result = std::move(init);
+  for (auto &slot : partial)
+    result = combine(std::move(result), std::move(slot.value));
+  return result;
+};
+
+template <typename Container, typename T, typename Op>
+T parallel_reduce(Container &container, T init, Op op) {
+  static_assert(std::is_invocable_r_v<T, Op &, T, T>,
+                "parallel_reduce combines with op, which must also accept "
+                "(T, T); pass a combine otherwise");
+  auto combine = [&op](T a, T b) -> T {
+    return op(std::move(a), std::move(b));
+  };
+  return parallel_reduce(container, std::move(init), op, combine,
+                         parallel_default_threads());
+};
+
+}  // namespace s21
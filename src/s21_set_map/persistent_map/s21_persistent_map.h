@@ -0,0 +1,63 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_MAP_S21_PERSISTENT_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_MAP_S21_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../persistent_tree/s21_persistent_tree.h"
+
+namespace s21 {
+
+// Map with O(1) copies, see PersistentTree. Values are changed through
+// insert_or_assign only, there is no operator[] handing out a reference into
+// nodes that other versions may share.
+template <typename Key, typename T>
+class persistent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator =
+      typename PersistentTree<value_type, MapKeyOf<value_type>>::ConstIterator;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  persistent_map();
+  persistent_map(std::initializer_list<value_type> const &items);
+  persistent_map(const persistent_map &m);
+  persistent_map(persistent_map &&m);
+  ~persistent_map(){};
+  persistent_map &operator=(const persistent_map &m);
+  persistent_map &operator=(persistent_map &&m);
+
+  const T &at(const Key &key) const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(persistent_map &other);
+
+  iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+
+ private:
+  PersistentTree<value_type, MapKeyOf<value_type>> tree_;
+};
+};  // namespace s21
+
+#include "s21_persistent_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_MAP_S21_PERSISTENT_MAP_H_
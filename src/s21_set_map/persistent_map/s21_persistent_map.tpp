@@ -0,0 +1,127 @@
+namespace s21 {
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type>::persistent_map() : tree_{} {};
+
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type>::persistent_map(
+    std::initializer_list<value_type> const &items)
+    : tree_{} {
+  for (const auto &item : items) tree_.insert(item);
+};
+
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type>::persistent_map(const persistent_map &m)
+    : tree_{m.tree_} {};
+
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type>::persistent_map(persistent_map &&m)
+    : tree_{std::move(m.tree_)} {};
+
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type> &
+persistent_map<key_type, mapped_type>::operator=(const persistent_map &m) {
+  tree_ = m.tree_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+persistent_map<key_type, mapped_type> &
+persistent_map<key_type, mapped_type>::operator=(persistent_map &&m) {
+  tree_ = std::move(m.tree_);
+  return *this;
+};
+
+template <typename key_type, typename mapped_type>
+const mapped_type &persistent_map<key_type, mapped_type>::at(
+    const key_type &key) const {
+  auto it = tree_.find(key);
+  if (it == tree_.end())
+    throw std::out_of_range("Map dosen't contain this elem!");
+  return (*it).second;
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::iterator
+persistent_map<key_type, mapped_type>::begin() const {
+  return tree_.begin();
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::iterator
+persistent_map<key_type, mapped_type>::end() const {
+  return tree_.end();
+};
+
+template <typename key_type, typename mapped_type>
+bool persistent_map<key_type, mapped_type>::empty() const {
+  return tree_.empty();
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::size_type
+persistent_map<key_type, mapped_type>::size() const {
+  return tree_.get_size();
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::size_type
+persistent_map<key_type, mapped_type>::max_size() const {
+  return tree_.max_size();
+};
+
+template <typename key_type, typename mapped_type>
+void persistent_map<key_type, mapped_type>::clear() {
+  tree_.clear();
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename persistent_map<key_type, mapped_type>::iterator, bool>
+persistent_map<key_type, mapped_type>::insert(const value_type &value) {
+  bool inserted = tree_.insert(value);
+  return std::pair<iterator, bool>{tree_.find(value.first), inserted};
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename persistent_map<key_type, mapped_type>::iterator, bool>
+persistent_map<key_type, mapped_type>::insert(const key_type &key,
+                                              const mapped_type &obj) {
+  return insert(value_type{key, obj});
+};
+
+template <typename key_type, typename mapped_type>
+std::pair<typename persistent_map<key_type, mapped_type>::iterator, bool>
+persistent_map<key_type, mapped_type>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  bool inserted = tree_.insert_or_assign(value_type{key, obj});
+  return std::pair<iterator, bool>{tree_.find(key), inserted};
+};
+
+template <typename key_type, typename mapped_type>
+void persistent_map<key_type, mapped_type>::erase(iterator pos) {
+  tree_.erase((*pos).first);
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::size_type
+persistent_map<key_type, mapped_type>::erase(const key_type &key) {
+  return tree_.erase(key);
+};
+
+template <typename key_type, typename mapped_type>
+void persistent_map<key_type, mapped_type>::swap(persistent_map &other) {
+  tree_.swap(other.tree_);
+};
+
+template <typename key_type, typename mapped_type>
+typename persistent_map<key_type, mapped_type>::iterator
+persistent_map<key_type, mapped_type>::find(const key_type &key) const {
+  return tree_.find(key);
+};
+
+template <typename key_type, typename mapped_type>
+bool persistent_map<key_type, mapped_type>::contains(
+    const key_type &key) const {
+  return tree_.find(key) != tree_.end();
+};
+
+}  // namespace s21
@@ -0,0 +1,57 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_SET_S21_PERSISTENT_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_SET_S21_PERSISTENT_SET_H_
+
+#include <initializer_list>
+#include <utility>
+
+#include "../persistent_tree/s21_persistent_tree.h"
+
+namespace s21 {
+
+// Set with O(1) copies, see PersistentTree. The elements are immutable, so
+// only const iterators are provided.
+template <typename Key>
+class persistent_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator =
+      typename PersistentTree<value_type, SetKeyOf<value_type>>::ConstIterator;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  persistent_set();
+  persistent_set(std::initializer_list<value_type> const &items);
+  persistent_set(const persistent_set &s);
+  persistent_set(persistent_set &&s);
+  ~persistent_set(){};
+
+  persistent_set &operator=(const persistent_set &s);
+  persistent_set &operator=(persistent_set &&s);
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(persistent_set &other);
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+
+ private:
+  PersistentTree<value_type, SetKeyOf<value_type>> tree_;
+};
+};  // namespace s21
+
+#include "s21_persistent_set.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_SET_S21_PERSISTENT_SET_H_
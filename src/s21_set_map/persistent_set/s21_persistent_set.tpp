@@ -0,0 +1,115 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type>
+persistent_set<value_type>::persistent_set() : tree_{} {};
+
+template <typename value_type>
+persistent_set<value_type>::persistent_set(
+    std::initializer_list<value_type> const &items)
+    : tree_{} {
+  for (const auto &item : items) tree_.insert(item);
+};
+
+template <typename value_type>
+persistent_set<value_type>::persistent_set(const persistent_set &s)
+    : tree_{s.tree_} {};
+
+template <typename value_type>
+persistent_set<value_type>::persistent_set(persistent_set &&s)
+    : tree_{std::move(s.tree_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type>
+persistent_set<value_type> &persistent_set<value_type>::operator=(
+    const persistent_set &s) {
+  tree_ = s.tree_;
+  return *this;
+};
+
+template <typename value_type>
+persistent_set<value_type> &persistent_set<value_type>::operator=(
+    persistent_set &&s) {
+  tree_ = std::move(s.tree_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type>
+typename persistent_set<value_type>::iterator
+persistent_set<value_type>::begin() const {
+  return tree_.begin();
+};
+
+template <typename value_type>
+typename persistent_set<value_type>::iterator
+persistent_set<value_type>::end() const {
+  return tree_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type>
+bool persistent_set<value_type>::empty() const {
+  return tree_.empty();
+};
+
+template <typename value_type>
+typename persistent_set<value_type>::size_type
+persistent_set<value_type>::size() const {
+  return tree_.get_size();
+};
+
+template <typename value_type>
+typename persistent_set<value_type>::size_type
+persistent_set<value_type>::max_size() const {
+  return tree_.max_size();
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type>
+void persistent_set<value_type>::clear() {
+  tree_.clear();
+};
+
+template <typename value_type>
+std::pair<typename persistent_set<value_type>::iterator, bool>
+persistent_set<value_type>::insert(const value_type &value) {
+  bool inserted = tree_.insert(value);
+  return std::pair<iterator, bool>{tree_.find(value), inserted};
+};
+
+template <typename value_type>
+void persistent_set<value_type>::erase(iterator pos) {
+  tree_.erase(*pos);
+};
+
+template <typename value_type>
+typename persistent_set<value_type>::size_type
+persistent_set<value_type>::erase(const key_type &key) {
+  return tree_.erase(key);
+};
+
+template <typename value_type>
+void persistent_set<value_type>::swap(persistent_set &other) {
+  tree_.swap(other.tree_);
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type>
+typename persistent_set<value_type>::iterator persistent_set<value_type>::find(
+    const key_type &key) const {
+  return tree_.find(key);
+};
+
+template <typename value_type>
+bool persistent_set<value_type>::contains(const key_type &key) const {
+  return tree_.find(key) != tree_.end();
+};
+
+}  // namespace s21
@@ -0,0 +1,114 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_TREE_S21_PERSISTENT_TREE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_TREE_S21_PERSISTENT_TREE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "../tree/s21_key_of.h"
+
+namespace s21 {
+
+// Node shared between versions: never modified once built, freed when the
+// last version or parent referencing it lets it go. The count is atomic so
+// that versions can be dropped on different threads.
+template <typename V>
+struct PersistentNode {
+  PersistentNode(const V& o_value, PersistentNode* o_left,
+                 PersistentNode* o_right);
+
+  V value;
+  PersistentNode *left, *right;
+  std::int32_t height;
+  std::atomic<std::uint32_t> refs;
+};
+
+// AVL tree with path copying: an update rebuilds the O(log n) nodes on the
+// path to the key and shares every other subtree with the previous version.
+// Copying a tree only takes a reference to the root, so every copy is a
+// snapshot that later updates of either side do not affect. There are no
+// parent pointers, a node can have many parents.
+template <typename V, typename KeyOf>
+class PersistentTree {
+ public:
+  class ConstIterator;
+
+  using key_type = typename KeyOf::key_type;
+  using node_type = PersistentNode<V>;
+  using const_iterator = ConstIterator;
+  using size_type = std::size_t;
+
+  PersistentTree() noexcept;
+  PersistentTree(const PersistentTree& other) noexcept;
+  PersistentTree(PersistentTree&& other) noexcept;
+  ~PersistentTree();
+
+  PersistentTree& operator=(const PersistentTree& other) noexcept;
+  PersistentTree& operator=(PersistentTree&& other) noexcept;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type get_size() const;
+  size_type max_size() const;
+
+  void clear();
+  bool insert(const V& value);
+  bool insert_or_assign(const V& value);
+  size_type erase(const key_type& key);
+  void swap(PersistentTree& other) noexcept;
+
+  const_iterator find(const key_type& key) const;
+
+  // Enough for any tree that fits in memory: an AVL tree of height 64 holds
+  // more than 10^13 nodes.
+  static constexpr int kMaxHeight = 64;
+
+  // Forward iterator walking the tree with its own stack of the ancestors
+  // still to visit.
+  class ConstIterator {
+   public:
+    ConstIterator();
+    explicit ConstIterator(const node_type* root);
+
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+    bool operator==(const ConstIterator& it) const;
+    bool operator!=(const ConstIterator& it) const;
+    const V& operator*() const;
+    const V* operator->() const;
+
+   private:
+    friend class PersistentTree;
+
+    const node_type* stack_[kMaxHeight];
+    int depth_;
+
+    void push_left(const node_type* node);
+  };
+
+ private:
+  node_type* root_;
+  size_type size_;
+
+  static node_type* retain(node_type* node);
+  static void release(node_type* node);
+  static std::int32_t height(const node_type* node);
+  static node_type* make(const V& value, node_type* left, node_type* right);
+  static node_type* rebalance(const V& value, node_type* left,
+                              node_type* right);
+
+  static node_type* insert_node(node_type* node, const V& value, bool assign,
+                                bool& inserted);
+  static node_type* erase_node(node_type* node, const key_type& key,
+                               bool& erased);
+  static node_type* erase_min(node_type* node, const V*& min);
+};
+};  // namespace s21
+
+#include "s21_persistent_tree.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_PERSISTENT_TREE_S21_PERSISTENT_TREE_H_
@@ -0,0 +1,343 @@
+namespace s21 {
+
+template <typename V>
+PersistentNode<V>::PersistentNode(const V& o_value, PersistentNode* o_left,
+                                  PersistentNode* o_right)
+    : value{o_value}, left{o_left}, right{o_right}, height{}, refs{1} {};
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::PersistentTree() noexcept : root_{}, size_{} {};
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::PersistentTree(const PersistentTree& other) noexcept
+    : root_{retain(other.root_)}, size_{other.size_} {};
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::PersistentTree(PersistentTree&& other) noexcept
+    : root_{other.root_}, size_{other.size_} {
+  other.root_ = nullptr;
+  other.size_ = 0;
+};
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::~PersistentTree() {
+  release(root_);
+};
+
+/* ------------------- OPERATORS --------------------- */
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>& PersistentTree<V, KeyOf>::operator=(
+    const PersistentTree& other) noexcept {
+  node_type* old = root_;
+  root_ = retain(other.root_);
+  size_ = other.size_;
+  release(old);
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>& PersistentTree<V, KeyOf>::operator=(
+    PersistentTree&& other) noexcept {
+  swap(other);
+  return *this;
+};
+
+/* ------------------- BEGIN / END --------------------- */
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::const_iterator
+PersistentTree<V, KeyOf>::begin() const {
+  return const_iterator{root_};
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::const_iterator
+PersistentTree<V, KeyOf>::end() const {
+  return const_iterator{};
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename V, typename KeyOf>
+bool PersistentTree<V, KeyOf>::empty() const {
+  return !size_;
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::size_type
+PersistentTree<V, KeyOf>::get_size() const {
+  return size_;
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::size_type
+PersistentTree<V, KeyOf>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(node_type) / 2;
+};
+
+/* ------------------- MODIFIERS --------------------- */
+
+template <typename V, typename KeyOf>
+void PersistentTree<V, KeyOf>::clear() {
+  release(root_);
+  root_ = nullptr;
+  size_ = 0;
+};
+
+template <typename V, typename KeyOf>
+bool PersistentTree<V, KeyOf>::insert(const V& value) {
+  bool inserted{};
+  node_type* root = insert_node(root_, value, false, inserted);
+  if (root) {
+    release(root_);
+    root_ = root;
+    ++size_;
+  }
+  return inserted;
+};
+
+template <typename V, typename KeyOf>
+bool PersistentTree<V, KeyOf>::insert_or_assign(const V& value) {
+  bool inserted{};
+  node_type* root = insert_node(root_, value, true, inserted);
+  release(root_);
+  root_ = root;
+  if (inserted) ++size_;
+  return inserted;
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::size_type PersistentTree<V, KeyOf>::erase(
+    const key_type& key) {
+  bool erased{};
+  node_type* root = erase_node(root_, key, erased);
+  if (!erased) return 0;
+  release(root_);
+  root_ = root;
+  --size_;
+  return 1;
+};
+
+template <typename V, typename KeyOf>
+void PersistentTree<V, KeyOf>::swap(PersistentTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+};
+
+/* ------------------- LOOKUP --------------------- */
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::const_iterator
+PersistentTree<V, KeyOf>::find(const key_type& key) const {
+  const node_type* node = root_;
+  while (node && (key < KeyOf{}(node->value) || KeyOf{}(node->value) < key))
+    node = key < KeyOf{}(node->value) ? node->left : node->right;
+  if (!node) return end();
+  // rebuild the ancestors the iterator still has to visit
+  const_iterator it{};
+  it.depth_ = 0;
+  for (const node_type* cur = root_; cur != node;) {
+    if (key < KeyOf{}(cur->value)) {
+      it.stack_[it.depth_++] = cur;
+      cur = cur->left;
+    } else {
+      cur = cur->right;
+    }
+  }
+  it.stack_[it.depth_++] = node;
+  return it;
+};
+
+/* ------------------- HELPERS --------------------- */
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type* PersistentTree<V, KeyOf>::retain(
+    node_type* node) {
+  if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+  return node;
+};
+
+template <typename V, typename KeyOf>
+void PersistentTree<V, KeyOf>::release(node_type* node) {
+  while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    release(node->left);
+    node_type* right = node->right;
+    delete node;
+    node = right;
+  }
+};
+
+template <typename V, typename KeyOf>
+std::int32_t PersistentTree<V, KeyOf>::height(const node_type* node) {
+  return node ? node->height : 0;
+};
+
+// Takes over the references to left and right.
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type* PersistentTree<V, KeyOf>::make(
+    const V& value, node_type* left, node_type* right) {
+  node_type* node = new node_type{value, left, right};
+  node->height = std::max(height(left), height(right)) + 1;
+  return node;
+};
+
+// make() for subtrees whose heights differ by up to two: the rotations build
+// new nodes from the parts of the taller side instead of relinking it.
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type*
+PersistentTree<V, KeyOf>::rebalance(const V& value, node_type* left,
+                                    node_type* right) {
+  node_type* result{};
+  if (height(left) > height(right) + 1) {
+    if (height(left->left) >= height(left->right)) {
+      result = make(left->value, retain(left->left),
+                    make(value, retain(left->right), right));
+    } else {
+      node_type* middle = left->right;
+      result = make(middle->value,
+                    make(left->value, retain(left->left), retain(middle->left)),
+                    make(value, retain(middle->right), right));
+    }
+    release(left);
+  } else if (height(right) > height(left) + 1) {
+    if (height(right->right) >= height(right->left)) {
+      result = make(right->value, make(value, left, retain(right->left)),
+                    retain(right->right));
+    } else {
+      node_type* middle = right->left;
+      result =
+          make(middle->value, make(value, left, retain(middle->left)),
+               make(right->value, retain(middle->right), retain(right->right)));
+    }
+    release(right);
+  } else {
+    result = make(value, left, right);
+  }
+  return result;
+};
+
+// Returns the new subtree or nullptr when nothing had to change, i.e. the
+// key is present and assign is not set.
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type*
+PersistentTree<V, KeyOf>::insert_node(node_type* node, const V& value,
+                                      bool assign, bool& inserted) {
+  node_type* result{};
+  const key_type& key = KeyOf{}(value);
+  if (!node) {
+    inserted = true;
+    result = make(value, nullptr, nullptr);
+  } else if (key < KeyOf{}(node->value)) {
+    node_type* left = insert_node(node->left, value, assign, inserted);
+    if (left) result = rebalance(node->value, left, retain(node->right));
+  } else if (KeyOf{}(node->value) < key) {
+    node_type* right = insert_node(node->right, value, assign, inserted);
+    if (right) result = rebalance(node->value, retain(node->left), right);
+  } else if (assign) {
+    result = make(value, retain(node->left), retain(node->right));
+  }
+  return result;
+};
+
+// Sets erased when the key was found, the result is the new subtree then
+// and may be nullptr.
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type*
+PersistentTree<V, KeyOf>::erase_node(node_type* node, const key_type& key,
+                                     bool& erased) {
+  node_type* result{};
+  if (!node) return result;
+  if (key < KeyOf{}(node->value)) {
+    node_type* left = erase_node(node->left, key, erased);
+    if (erased) result = rebalance(node->value, left, retain(node->right));
+  } else if (KeyOf{}(node->value) < key) {
+    node_type* right = erase_node(node->right, key, erased);
+    if (erased) result = rebalance(node->value, retain(node->left), right);
+  } else {
+    erased = true;
+    if (!node->left) {
+      result = retain(node->right);
+    } else if (!node->right) {
+      result = retain(node->left);
+    } else {
+      const V* min{};
+      node_type* right = erase_min(node->right, min);
+      result = rebalance(*min, retain(node->left), right);
+    }
+  }
+  return result;
+};
+
+// The smallest value stays owned by the old version, which is alive until
+// the caller swaps the roots.
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::node_type*
+PersistentTree<V, KeyOf>::erase_min(node_type* node, const V*& min) {
+  if (!node->left) {
+    min = &node->value;
+    return retain(node->right);
+  }
+  node_type* left = erase_min(node->left, min);
+  return rebalance(node->value, left, retain(node->right));
+};
+
+/* ------------------- ITERATOR --------------------- */
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::ConstIterator::ConstIterator() : depth_{} {};
+
+template <typename V, typename KeyOf>
+PersistentTree<V, KeyOf>::ConstIterator::ConstIterator(const node_type* root)
+    : depth_{} {
+  push_left(root);
+};
+
+template <typename V, typename KeyOf>
+void PersistentTree<V, KeyOf>::ConstIterator::push_left(
+    const node_type* node) {
+  for (; node; node = node->left) stack_[depth_++] = node;
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::ConstIterator&
+PersistentTree<V, KeyOf>::ConstIterator::operator++() {
+  const node_type* node = stack_[--depth_];
+  push_left(node->right);
+  return *this;
+};
+
+template <typename V, typename KeyOf>
+typename PersistentTree<V, KeyOf>::ConstIterator
+PersistentTree<V, KeyOf>::ConstIterator::operator++(int) {
+  ConstIterator tmp = *this;
+  operator++();
+  return tmp;
+};
+
+template <typename V, typename KeyOf>
+bool PersistentTree<V, KeyOf>::ConstIterator::operator==(
+    const ConstIterator& it) const {
+  if (!depth_ || !it.depth_) return depth_ == it.depth_;
+  return stack_[depth_ - 1] == it.stack_[it.depth_ - 1];
+};
+
+template <typename V, typename KeyOf>
+bool PersistentTree<V, KeyOf>::ConstIterator::operator!=(
+    const ConstIterator& it) const {
+  return !(*this == it);
+};
+
+template <typename V, typename KeyOf>
+const V& PersistentTree<V, KeyOf>::ConstIterator::operator*() const {
+  return stack_[depth_ - 1]->value;
+};
+
+template <typename V, typename KeyOf>
+const V* PersistentTree<V, KeyOf>::ConstIterator::operator->() const {
+  return &stack_[depth_ - 1]->value;
+};
+
+};  // namespace s21
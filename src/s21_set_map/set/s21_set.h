@@ -1,19 +1,24 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_SET_S21_SET_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_SET_S21_SET_H_
 
+#include <utility>
+
+#include "../bloom_filter/s21_bloom_filter.h"
 #include "../tree/s21_avl_tree.h"
 
 namespace s21 {
-template <typename Key>
+// Filter is a lookup filter policy, see NoFilter and BloomFilter.
+template <typename Key, typename Filter = NoFilter<Key>>
 class set {
  public:
   using key_type = Key;
   using value_type = Key;
-  using node_type = Node<key_type, value_type>;
+  using node_type = Node<value_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename AvlTree<key_type, value_type>::Iterator;
-  using const_iterator = typename AvlTree<key_type, value_type>::ConstIterator;
+  using tree_type = AvlTree<value_type>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
   using size_type = size_t;
 
   set();
@@ -34,15 +39,35 @@ class set {
 
   void clear();
   std::pair<iterator, bool> insert(const value_type &value);
-  void erase(iterator pos);
+  iterator erase(iterator pos);
+  size_type erase(const key_type &key);
+  iterator erase(iterator first, iterator last);
   void swap(set &other);
   void merge(set &other);
 
   iterator find(const key_type &key);
   bool contains(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  template <typename Keys, typename OutputIt>
+  void find_batch(const Keys &keys, OutputIt out);
+  template <typename Keys, typename OutputIt>
+  void contains_batch(const Keys &keys, OutputIt out);
+  template <typename OutputIt>
+  void split(size_type parts, OutputIt out);
+  template <typename Fn>
+  void for_each_in_range(const key_type &lo, const key_type &hi, Fn fn);
+
+  const Filter &filter() const;
 
  private:
-  AvlTree<key_type, value_type> tree_;
+  void refresh_filter();
+  void filter_insert(const key_type &key);
+  void filter_erase(size_type count);
+
+  tree_type tree_;
+  Filter filter_;
 };
 };  // namespace s21
 
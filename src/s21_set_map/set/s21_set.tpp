@@ -2,102 +2,238 @@ namespace s21 {
 
 /* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
 
-template <typename value_type>
-set<value_type>::set() : tree_{} {};
+template <typename value_type, typename Filter>
+set<value_type, Filter>::set() : tree_{}, filter_{} {};
 
-template <typename value_type>
-set<value_type>::set(std::initializer_list<value_type> const &items)
-    : tree_{items} {};
+template <typename value_type, typename Filter>
+set<value_type, Filter>::set(std::initializer_list<value_type> const &items)
+    : tree_{items}, filter_{} {
+  refresh_filter();
+};
 
-template <typename value_type>
-set<value_type>::set(const set &s) : tree_{s.tree_} {};
+template <typename value_type, typename Filter>
+set<value_type, Filter>::set(const set &s)
+    : tree_{s.tree_}, filter_{s.filter_} {};
 
-template <typename value_type>
-set<value_type>::set(set &&s) : tree_{std::move(s.tree_)} {};
+template <typename value_type, typename Filter>
+set<value_type, Filter>::set(set &&s)
+    : tree_{std::move(s.tree_)}, filter_{std::move(s.filter_)} {};
 
 /* ------------------------ OPERATORS --------------------------- */
 
-template <typename value_type>
-set<value_type> &set<value_type>::operator=(const set<value_type> &s) {
+template <typename value_type, typename Filter>
+set<value_type, Filter> &set<value_type, Filter>::operator=(const set &s) {
   tree_ = s.tree_;
+  filter_ = s.filter_;
   return *this;
 };
 
-template <typename value_type>
-set<value_type> &set<value_type>::operator=(set<value_type> &&s) {
+template <typename value_type, typename Filter>
+set<value_type, Filter> &set<value_type, Filter>::operator=(set &&s) {
   tree_ = std::move(s.tree_);
+  filter_ = std::move(s.filter_);
   return *this;
 };
 
 /* ------------------------ BEGIN / END -------------------------- */
 
-template <typename value_type>
-typename set<value_type>::iterator set<value_type>::begin() {
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::begin() {
   return iterator(tree_.begin());
 };
 
-template <typename value_type>
-typename set<value_type>::iterator set<value_type>::end() {
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::end() {
   return iterator(tree_.end());
 };
 
 /* ------------------------- CAPACITY ---------------------------- */
 
-template <typename value_type>
-bool set<value_type>::empty() {
+template <typename value_type, typename Filter>
+bool set<value_type, Filter>::empty() {
   return tree_.empty();
 };
 
-template <typename value_type>
-typename set<value_type>::size_type set<value_type>::size() {
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::size_type set<value_type, Filter>::size() {
   return tree_.get_size();
 };
 
-template <typename value_type>
-typename set<value_type>::size_type set<value_type>::max_size() {
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::size_type
+set<value_type, Filter>::max_size() {
   return tree_.max_size();
 };
 
 /* ------------------------- MODIFIRE ---------------------------- */
 
-template <typename value_type>
-void set<value_type>::clear() {
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::clear() {
   tree_.clear();
+  filter_.clear();
 };
 
-template <typename value_type>
-std::pair<typename set<value_type>::iterator, bool> set<value_type>::insert(
-    const value_type &value) {
-  node_type *tmp = tree_.insert(value);
+template <typename value_type, typename Filter>
+std::pair<typename set<value_type, Filter>::iterator, bool>
+set<value_type, Filter>::insert(const value_type &value) {
+  NodeBase *tmp = tree_.insert(value);
+  if (tmp) filter_insert(value);
   iterator it{tmp};
   return std::pair(it, tmp);
 };
 
-template <typename value_type>
-void set<value_type>::erase(iterator pos) {
-  tree_.erase(tree_.find(*pos));
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::erase(
+    iterator pos) {
+  iterator next = tree_.erase(pos);
+  filter_erase(1);
+  return next;
+};
+
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::size_type set<value_type, Filter>::erase(
+    const key_type &key) {
+  NodeBase *node = tree_.find(key);
+  if (node == tree_.end()) return 0;
+  tree_.erase(node);
+  filter_erase(1);
+  return 1;
 };
 
-template <typename value_type>
-void set<value_type>::swap(set<value_type> &other) {
+// O(k + log n): the tree is split around the range instead of unlinking the
+// keys one by one.
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::erase(
+    iterator first, iterator last) {
+  size_type before = tree_.get_size();
+  iterator next = tree_.erase(first, last);
+  filter_erase(before - tree_.get_size());
+  return next;
+};
+
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::swap(set &other) {
   std::swap(tree_, other.tree_);
+  std::swap(filter_, other.filter_);
 };
 
-template <typename value_type>
-void set<value_type>::merge(set<value_type> &other) {
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::merge(set &other) {
+  size_type before = tree_.get_size();
   tree_.merge(other.tree_);
+  size_type moved = tree_.get_size() - before;
+  if (!moved) return;
+  filter_.invalidate();
+  refresh_filter();
+  other.filter_erase(moved);
 }
 
 /* ----------------------------- LOOKUP ------------------------------- */
 
-template <typename value_type>
-typename set<value_type>::iterator set<value_type>::find(const key_type &key) {
+// A definite miss of the filter skips the tree walk.
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::find(
+    const key_type &key) {
+  if (!filter_.may_contain(key)) return end();
   return iterator{tree_.find(key)};
 };
 
-template <typename value_type>
-bool set<value_type>::contains(const key_type &key) {
-  return tree_.find(key) != tree_.end();
+template <typename value_type, typename Filter>
+bool set<value_type, Filter>::contains(const key_type &key) {
+  return filter_.may_contain(key) && tree_.find(key) != tree_.end();
+};
+
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::lower_bound(
+    const key_type &key) {
+  return iterator{tree_.lower_bound(key)};
+};
+
+template <typename value_type, typename Filter>
+typename set<value_type, Filter>::iterator set<value_type, Filter>::upper_bound(
+    const key_type &key) {
+  return iterator{tree_.upper_bound(key)};
+};
+
+template <typename value_type, typename Filter>
+std::pair<typename set<value_type, Filter>::iterator,
+          typename set<value_type, Filter>::iterator>
+set<value_type, Filter>::equal_range(const key_type &key) {
+  return std::pair<iterator, iterator>{lower_bound(key), upper_bound(key)};
+};
+
+// Calls fn(const value_type &) for the keys in [lo, hi). Both bounds are
+// located up front, the walk between them compares no keys.
+template <typename value_type, typename Filter>
+template <typename Fn>
+void set<value_type, Filter>::for_each_in_range(
+    const key_type &lo, const key_type &hi, Fn fn) {
+  if (!(lo < hi)) return;
+  NodeBase *last = tree_.lower_bound(hi);
+  for (NodeBase *node = tree_.lower_bound(lo); node != last;
+       node = node->next_node()) {
+    const value_type &value = tree_type::value_of(node);
+    fn(value);
+  }
+};
+
+// Writes an iterator per key of keys to out, end() for the missing ones.
+// Faster than calling find in a loop on trees that do not fit in cache,
+// see AvlTree::find_batch.
+template <typename value_type, typename Filter>
+template <typename Keys, typename OutputIt>
+void set<value_type, Filter>::find_batch(const Keys &keys, OutputIt out) {
+  tree_.find_batch(keys, [&out](NodeBase *node) { *out++ = iterator{node}; });
+};
+
+// Writes whether each key of keys is present to out.
+template <typename value_type, typename Filter>
+template <typename Keys, typename OutputIt>
+void set<value_type, Filter>::contains_batch(const Keys &keys, OutputIt out) {
+  NodeBase *last = tree_.end();
+  tree_.find_batch(keys,
+                   [&out, last](NodeBase *node) { *out++ = node != last; });
+};
+
+// Writes about parts + 1 iterators to out, from begin() to end(), that cut
+// the set into ranges of similar sizes along subtree boundaries. The ranges
+// can be walked concurrently, see parallel_for_each.
+template <typename value_type, typename Filter>
+template <typename OutputIt>
+void set<value_type, Filter>::split(size_type parts, OutputIt out) {
+  tree_.split(parts, [&out](NodeBase *node) { *out++ = iterator{node}; });
+};
+
+/* ----------------------------- FILTER ------------------------------- */
+
+template <typename value_type, typename Filter>
+const Filter &set<value_type, Filter>::filter() const {
+  return filter_;
+};
+
+// Rebuilds the filter from the keys in the tree once it asks for it.
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::refresh_filter() {
+  if (!filter_.full() && !filter_.stale()) return;
+  filter_.reset(tree_.get_size());
+  for (NodeBase *node = tree_.begin(); node != tree_.end();
+       node = node->next_node())
+    filter_.insert(tree_type::value_of(node));
+};
+
+// Called after the key went into the tree, so a rebuild picks it up too.
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::filter_insert(const key_type &key) {
+  if (filter_.full())
+    refresh_filter();
+  else
+    filter_.insert(key);
+};
+
+template <typename value_type, typename Filter>
+void set<value_type, Filter>::filter_erase(size_type count) {
+  filter_.erase(count);
+  refresh_filter();
 };
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
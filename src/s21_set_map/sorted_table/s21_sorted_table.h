@@ -0,0 +1,65 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_SORTED_TABLE_S21_SORTED_TABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_SORTED_TABLE_S21_SORTED_TABLE_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace s21 {
+
+// On-disk layout of a sorted key-value table, written by map::dump_sorted
+// and read in place by mapped_table. Keys and values are stored as raw
+// bytes in host byte order, so both have to be trivially copyable and the
+// file is only portable between hosts of the same ABI.
+//
+//   header     SortedTableHeader, padded to kSortedTableAlignment
+//   keys       count keys in ascending order
+//   index      every index_stride-th key, keys[0], keys[stride], ...
+//   values     count values, values[i] belongs to keys[i]
+//
+// Every region starts at a multiple of kSortedTableAlignment, so once the
+// file is mapped at a page boundary the regions are arrays of their types.
+// A lookup binary searches the index, which stays small and hot in cache,
+// and then one stride of keys.
+
+constexpr std::size_t kSortedTableAlignment = 64;
+constexpr std::uint64_t kSortedTableStride = 64;
+constexpr char kSortedTableMagic[8] = {'S', '2', '1', 'S', 'T', 'B', 'L', '1'};
+
+struct SortedTableHeader {
+  char magic[8];
+  std::uint32_t key_size;
+  std::uint32_t value_size;
+  std::uint64_t count;
+  std::uint64_t index_stride;
+  std::uint64_t index_count;
+  std::uint64_t keys_offset;
+  std::uint64_t index_offset;
+  std::uint64_t values_offset;
+  std::uint64_t file_size;
+};
+
+// Rounds offset up to the next multiple of kSortedTableAlignment.
+inline std::uint64_t sorted_table_align(std::uint64_t offset);
+
+// Fills in the sizes and offsets of a table of count pairs.
+template <typename Key, typename T>
+SortedTableHeader make_sorted_table_header(std::uint64_t count);
+
+// Writes the pairs of the sorted range [first, last), count of them, to
+// path. The range is walked once per region. Throws std::system_error when
+// the file can not be written.
+template <typename Key, typename T, typename ForwardIt>
+void write_sorted_table(const std::string &path, ForwardIt first,
+                        ForwardIt last, std::uint64_t count);
+};  // namespace s21
+
+#include "s21_sorted_table.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_SORTED_TABLE_S21_SORTED_TABLE_H_
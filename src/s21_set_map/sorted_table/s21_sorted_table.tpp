@@ -0,0 +1,74 @@
+namespace s21 {
+
+inline std::uint64_t sorted_table_align(std::uint64_t offset) {
+  return (offset + kSortedTableAlignment - 1) / kSortedTableAlignment *
+         kSortedTableAlignment;
+};
+
+template <typename Key, typename T>
+SortedTableHeader make_sorted_table_header(std::uint64_t count) {
+  static_assert(std::is_trivially_copyable_v<Key> &&
+                    std::is_trivially_copyable_v<T>,
+                "a sorted table stores keys and values as raw bytes");
+  static_assert(alignof(Key) <= kSortedTableAlignment &&
+                    alignof(T) <= kSortedTableAlignment,
+                "the regions are only aligned to kSortedTableAlignment");
+  SortedTableHeader header{};
+  std::memcpy(header.magic, kSortedTableMagic, sizeof(header.magic));
+  header.key_size = sizeof(Key);
+  header.value_size = sizeof(T);
+  header.count = count;
+  header.index_stride = kSortedTableStride;
+  header.index_count = (count + kSortedTableStride - 1) / kSortedTableStride;
+  header.keys_offset = sorted_table_align(sizeof(SortedTableHeader));
+  header.index_offset =
+      sorted_table_align(header.keys_offset + count * sizeof(Key));
+  header.values_offset = sorted_table_align(
+      header.index_offset + header.index_count * sizeof(Key));
+  header.file_size = header.values_offset + count * sizeof(T);
+  return header;
+};
+
+// The table is written next to path and renamed over it once complete, so
+// a reader never maps a half written file.
+template <typename Key, typename T, typename ForwardIt>
+void write_sorted_table(const std::string &path, ForwardIt first,
+                        ForwardIt last, std::uint64_t count) {
+  SortedTableHeader header = make_sorted_table_header<Key, T>(count);
+  std::string tmp_path = path + ".tmp";
+  std::FILE *file = std::fopen(tmp_path.c_str(), "wb");
+  if (!file) throw std::system_error(errno, std::generic_category(), path);
+  std::uint64_t offset{};
+  bool ok = true;
+  auto put = [&](const void *data, std::size_t size) {
+    ok = ok && std::fwrite(data, 1, size, file) == size;
+    offset += size;
+  };
+  auto pad_to = [&](std::uint64_t target) {
+    static constexpr char kZeros[kSortedTableAlignment] = {};
+    while (ok && offset < target)
+      put(kZeros, std::min<std::uint64_t>(target - offset, sizeof(kZeros)));
+  };
+  std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+  put(&header, sizeof(header));
+  pad_to(header.keys_offset);
+  for (ForwardIt it = first; ok && it != last; ++it)
+    put(&(*it).first, sizeof(Key));
+  pad_to(header.index_offset);
+  std::uint64_t i{};
+  for (ForwardIt it = first; ok && it != last; ++it, ++i)
+    if (i % kSortedTableStride == 0) put(&(*it).first, sizeof(Key));
+  pad_to(header.values_offset);
+  for (ForwardIt it = first; ok && it != last; ++it)
+    put(&(*it).second, sizeof(T));
+  int error = ok ? 0 : (errno ? errno : EIO);
+  if (std::fclose(file) && !error) error = errno ? errno : EIO;
+  if (!error && offset != header.file_size) error = EINVAL;
+  if (!error && std::rename(tmp_path.c_str(), path.c_str())) error = errno;
+  if (error) {
+    std::remove(tmp_path.c_str());
+    throw std::system_error(error, std::generic_category(), path);
+  }
+};
+
+}  // namespace s21
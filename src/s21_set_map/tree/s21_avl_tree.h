@@ -2,31 +2,52 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_AVL_TREE_H_
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "s21_key_of.h"
+#include "s21_node_handle.h"
+
 namespace s21 {
 
-template <typename K, typename V>
-struct Node {
-  Node();
-  Node(K o_value, int o_height);
+// Links and height of a node. The end sentinel is a bare NodeBase embedded
+// in the tree, told apart by its height of -1, so it holds no value and an
+// empty tree allocates nothing.
+struct NodeBase {
+  NodeBase* next_node();
+  NodeBase* previous_node();
+
+  NodeBase *parent = nullptr, *left = nullptr, *right = nullptr;
+  std::int8_t height = 0;
+};
 
-  Node* next_node();
-  Node* previous_node();
+template <typename K>
+struct Node : NodeBase {
+  explicit Node(const K& o_value);
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args&&... args);
 
   K value;
-  int height;
-  Node *parent = nullptr, *left = nullptr, *right = nullptr;
 };
 
-template <typename K, typename V>
+// Values are ordered by the key KeyOf extracts from them, so that a map
+// compares keys only and never the mapped values.
+template <typename K, typename KeyOf = SetKeyOf<K>>
 class AvlTree {
  public:
+  // Lookups find_batch keeps in flight at once.
+  static constexpr std::size_t kBatchLanes = 16;
+
   class Iterator;
   class ConstIterator;
 
-  using node_type = Node<K, V>;
-  using reference = V&;
-  using const_reference = const V&;
+  using key_type = typename KeyOf::key_type;
+  using node_type = Node<K>;
+  using reference = K&;
+  using const_reference = const K&;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
 
@@ -36,13 +57,32 @@ class AvlTree {
   AvlTree(AvlTree&& other) noexcept;
   ~AvlTree();
 
-  node_type* insert(const K& key);
+  NodeBase* insert(const K& key);
+  NodeBase* insert_multi(const K& key);
+  template <typename... Args>
+  NodeBase* try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<NodeBase*, bool> emplace(Args&&... args);
+  NodeBase* insert_node(NodeHandle<K>& handle);
+  NodeHandle<K> extract(NodeBase* node);
+  NodeHandle<K> extract(iterator pos);
   void merge(AvlTree& other);
-  void erase(node_type*);
-  node_type* find(const K& key);
-  node_type* lower_bound(const K& key);
+  void erase(NodeBase* node);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  size_t erase_range(NodeBase* first, NodeBase* last);
+  NodeBase* find(const key_type& key);
+  NodeBase* lower_bound(const key_type& key);
+  NodeBase* upper_bound(const key_type& key);
+  template <typename Keys, typename Fn>
+  void find_batch(const Keys& keys, Fn fn);
+  template <typename Fn>
+  void split(size_t parts, Fn fn);
   void clear();
 
+  static K& value_of(NodeBase* node);
+  static const K& value_of(const NodeBase* node);
+
   bool empty() const;
   size_t get_size() const;
   size_t max_size() const;
@@ -50,13 +90,13 @@ class AvlTree {
   AvlTree& operator=(const AvlTree& other);
   AvlTree& operator=(AvlTree&& other);
 
-  node_type* begin();
-  node_type* end();
+  NodeBase* begin();
+  NodeBase* end();
 
   class Iterator {
    public:
     Iterator();
-    explicit Iterator(node_type* node);
+    explicit Iterator(NodeBase* node);
     Iterator(const iterator& other);
     Iterator(iterator&& other);
 
@@ -71,13 +111,15 @@ class AvlTree {
     K& operator*();
 
    protected:
-    node_type* iterator_node_;
+    friend class AvlTree;
+
+    NodeBase* iterator_node_;
   };
 
   class ConstIterator : public Iterator {
    public:
     ConstIterator() : Iterator{} {};
-    explicit ConstIterator(node_type* node) : Iterator{node} {};
+    explicit ConstIterator(NodeBase* node) : Iterator{node} {};
     ConstIterator(const const_iterator& other) : Iterator{other} {};
     ConstIterator(const iterator& other) : Iterator{other} {};
     ConstIterator(const_iterator&& other) : Iterator{std::move(other)} {};
@@ -86,29 +128,47 @@ class AvlTree {
 
  private:
   size_t size_;
-  node_type* head_;
-
-  void delete_nodes(node_type* node);
-  void swap_node(node_type* one, node_type* two);
-
-  AvlTree& copy_tree(node_type* node, const node_type* other_node);
-  AvlTree& swap_tree(AvlTree<K, V>&& other_tree);
-
-  node_type* inner_insert(node_type* node, const K& key);
-
-  void balance(node_type* node, int diff);
-  int get_balance(const node_type* node) const;
-  void balance_after_erase(node_type* node);
-
-  int get_height(const node_type* node) const;
-  void update_height(node_type* node);
-
-  void left_rotate(node_type* node);
-  void right_rotate(node_type* node);
-
-  node_type* find_extremum(node_type* node, int balance);
-
-  void create_end();
+  NodeBase* head_;
+  NodeBase end_;
+
+  void delete_nodes(NodeBase* node);
+  void swap_node(NodeBase* one, NodeBase* two);
+
+  NodeBase* clone_node(const NodeBase* other_node);
+  AvlTree& copy_tree(NodeBase* node, const NodeBase* other_node);
+  AvlTree& swap_tree(AvlTree&& other_tree);
+
+  template <typename Make>
+  NodeBase* link(const key_type& key, bool multi, Make& make);
+  template <typename Make>
+  NodeBase* inner_insert(NodeBase* node, const key_type& key, bool multi,
+                         Make& make);
+  NodeBase* unlink(NodeBase* node);
+  template <typename Fn>
+  static void split_points(NodeBase* node, size_t levels, Fn& fn);
+
+  void balance(NodeBase* node, int diff);
+  int get_balance(const NodeBase* node) const;
+  void balance_after_erase(NodeBase* node);
+
+  int get_height(const NodeBase* node) const;
+  void update_height(NodeBase* node);
+
+  void left_rotate(NodeBase* node);
+  void right_rotate(NodeBase* node);
+
+  NodeBase* find_extremum(NodeBase* node, int balance);
+
+  NodeBase* subtree_left_rotate(NodeBase* node);
+  NodeBase* subtree_right_rotate(NodeBase* node);
+  NodeBase* subtree_balance(NodeBase* node);
+  NodeBase* join(NodeBase* left, NodeBase* pivot, NodeBase* right);
+  NodeBase* join_right(NodeBase* left, NodeBase* pivot, NodeBase* right);
+  NodeBase* join_left(NodeBase* left, NodeBase* pivot, NodeBase* right);
+  std::pair<NodeBase*, NodeBase*> split_before(NodeBase* node, NodeBase* root);
+  NodeBase* take_min(NodeBase* root, NodeBase*& min);
+
+  void set_root(NodeBase* root);
 };
 };  // namespace s21
 
@@ -2,67 +2,79 @@ namespace s21 {
 
 /* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
 
-template <typename K, typename V>
-AvlTree<K, V>::AvlTree() noexcept : size_{}, head_{} {};
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::AvlTree() noexcept
+    : size_{}, head_{}, end_{nullptr, nullptr, nullptr, -1} {};
 
-template <typename K, typename V>
-AvlTree<K, V>::AvlTree(std::initializer_list<K> const& init) : AvlTree() {
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::AvlTree(std::initializer_list<K> const& init)
+    : AvlTree() {
   for (auto i : init) insert(i);
 };
 
-template <typename K, typename V>
-AvlTree<K, V>::AvlTree(const AvlTree<K, V>& other)
-    : size_{other.size_}, head_{nullptr} {
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::AvlTree(const AvlTree<K, KeyOf>& other) : AvlTree() {
   if (other.head_) {
-    head_ = new Node<K, V>{other.head_->value, other.head_->height};
-    create_end();
+    set_root(clone_node(other.head_));
     copy_tree(head_, other.head_);
+    size_ = other.size_;
   }
 };
 
-template <typename K, typename V>
-AvlTree<K, V>::AvlTree(AvlTree<K, V>&& other) noexcept
-    : size_(other.size_), head_(other.head_) {
-  other.head_ = nullptr;
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::AvlTree(AvlTree<K, KeyOf>&& other) noexcept : AvlTree() {
+  set_root(other.head_);
+  size_ = other.size_;
+  other.set_root(nullptr);
   other.size_ = 0;
 }
 
-template <typename K, typename V>
-AvlTree<K, V>::~AvlTree() {
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::~AvlTree() {
   clear();
 };
 
 /* ------------------- OPERATORS --------------------- */
 
-template <typename K, typename V>
-AvlTree<K, V>& AvlTree<K, V>::operator=(const AvlTree<K, V>& other) {
-  if (head_ == other.head_) return *this;
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>& AvlTree<K, KeyOf>::operator=(const AvlTree& other) {
+  if (this == &other) return *this;
   clear();
-  size_ = other.size_;
-  if (other.size_)
-    head_ = new Node<K, V>{other.head_->value, other.head_->height};
-  return copy_tree(head_, other.head_);
+  if (other.head_) {
+    set_root(clone_node(other.head_));
+    copy_tree(head_, other.head_);
+    size_ = other.size_;
+  }
+  return *this;
 };
 
-template <typename K, typename V>
-AvlTree<K, V>& AvlTree<K, V>::operator=(AvlTree<K, V>&& other) {
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>& AvlTree<K, KeyOf>::operator=(AvlTree&& other) {
   return swap_tree(std::move(other));
 };
 
 /* ------------------- insert --------------------- */
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::inner_insert(Node<K, V>* node, const K& key) {
-  Node<K, V>* tmp{};
-  if (key > node->value && node->right) tmp = inner_insert(node->right, key);
-  if (key < node->value && node->left) tmp = inner_insert(node->left, key);
-  if (!node->right && key > node->value) {
-    node->right = new Node<K, V>{key, 0};
+// make() allocates the new node once its place is found, nothing is built
+// when the key is already present and multi is not set.
+template <typename K, typename KeyOf>
+template <typename Make>
+NodeBase* AvlTree<K, KeyOf>::inner_insert(NodeBase* node, const key_type& key,
+                                          bool multi, Make& make) {
+  NodeBase* tmp{};
+  bool less = key < KeyOf{}(value_of(node));
+  // equal keys go right, after the ones already present
+  bool greater = multi ? !less : KeyOf{}(value_of(node)) < key;
+  if (greater && node->right)
+    tmp = inner_insert(node->right, key, multi, make);
+  if (less && node->left) tmp = inner_insert(node->left, key, multi, make);
+  if (!node->right && greater) {
+    node->right = make();
     node->right->parent = node;
     tmp = node->right;
     ++size_;
-  } else if (!node->left && key < node->value) {
-    node->left = new Node<K, V>{key, 0};
+  } else if (!node->left && less) {
+    node->left = make();
     node->left->parent = node;
     tmp = node->left;
     ++size_;
@@ -72,41 +84,99 @@ Node<K, V>* AvlTree<K, V>::inner_insert(Node<K, V>* node, const K& key) {
   return tmp;
 }
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::insert(const K& key) {
-  Node<K, V>* result{};
+template <typename K, typename KeyOf>
+template <typename Make>
+NodeBase* AvlTree<K, KeyOf>::link(const key_type& key, bool multi,
+                                  Make& make) {
+  NodeBase* result{};
   if (!size_) {
     size_ = 1;
-    head_ = new Node<K, V>{key, 0};
-    result = head_;
-    create_end();
+    result = make();
+    set_root(result);
   } else {
-    result = inner_insert(head_, key);
+    result = inner_insert(head_, key, multi, make);
   }
   return result;
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::clear() {
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::insert(const K& key) {
+  auto make = [&key] { return new node_type{key}; };
+  return link(KeyOf{}(key), false, make);
+}
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::insert_multi(const K& key) {
+  auto make = [&key] { return new node_type{key}; };
+  return link(KeyOf{}(key), true, make);
+}
+
+// Builds the value from args only when key is missing. The arguments may
+// refer to key itself, they are used after the last comparison.
+template <typename K, typename KeyOf>
+template <typename... Args>
+NodeBase* AvlTree<K, KeyOf>::try_emplace(const key_type& key,
+                                         Args&&... args) {
+  auto make = [&] {
+    return new node_type{std::in_place, std::forward<Args>(args)...};
+  };
+  return link(key, false, make);
+}
+
+// The value has to exist before its key can be compared, so it is built
+// first and dropped again when the key is taken. Returns the node holding
+// the key and whether it is the new one.
+template <typename K, typename KeyOf>
+template <typename... Args>
+std::pair<NodeBase*, bool> AvlTree<K, KeyOf>::emplace(Args&&... args) {
+  NodeHandle<K> handle{
+      new node_type{std::in_place, std::forward<Args>(args)...}};
+  NodeBase* node = insert_node(handle);
+  if (node) return {node, true};
+  return {find(KeyOf{}(handle.value())), false};
+}
+
+// Links the node of handle and empties it, or leaves it alone and returns
+// nullptr when the key is present.
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::insert_node(NodeHandle<K>& handle) {
+  NodeBase* node = handle.node_;
+  auto make = [node] { return node; };
+  NodeBase* result = link(KeyOf{}(handle.value()), false, make);
+  if (result) handle.node_ = nullptr;
+  return result;
+}
+
+template <typename K, typename KeyOf>
+NodeHandle<K> AvlTree<K, KeyOf>::extract(NodeBase* node) {
+  return NodeHandle<K>{static_cast<node_type*>(unlink(node))};
+}
+
+template <typename K, typename KeyOf>
+NodeHandle<K> AvlTree<K, KeyOf>::extract(iterator pos) {
+  return extract(pos.iterator_node_);
+}
+
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::clear() {
   if (head_) {
-    delete head_->parent;
     delete_nodes(head_);
-    head_ = nullptr;
+    set_root(nullptr);
     size_ = 0;
   };
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::delete_nodes(Node<K, V>* node) {
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::delete_nodes(NodeBase* node) {
   if (node->left) delete_nodes(node->left);
   if (node->right) delete_nodes(node->right);
-  delete node;
+  delete static_cast<node_type*>(node);
 }
 
 /* --------------- balance ------------------- */
 
-template <typename K, typename V>
-void AvlTree<K, V>::balance(Node<K, V>* node, int diff) {
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::balance(NodeBase* node, int diff) {
   if (diff == 2) {
     if (get_balance(node->left) == -1) left_rotate(node->left);
     right_rotate(node);
@@ -116,9 +186,9 @@ void AvlTree<K, V>::balance(Node<K, V>* node, int diff) {
   }
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::right_rotate(Node<K, V>* node) {
-  Node<K, V>* buffer = node->right;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::right_rotate(NodeBase* node) {
+  NodeBase* buffer = node->right;
   swap_node(node, node->left);
   node = node->parent;
   node->right = node->left;
@@ -132,9 +202,9 @@ void AvlTree<K, V>::right_rotate(Node<K, V>* node) {
   update_height(node);
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::left_rotate(Node<K, V>* node) {
-  Node<K, V>* buffer = node->left;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::left_rotate(NodeBase* node) {
+  NodeBase* buffer = node->left;
   swap_node(node, node->right);
   node = node->parent;
   node->left = node->right;
@@ -148,116 +218,226 @@ void AvlTree<K, V>::left_rotate(Node<K, V>* node) {
   update_height(node);
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::update_height(Node<K, V>* node) {
-  node->height = std::max(get_height(node->left), get_height(node->right)) + 1;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::update_height(NodeBase* node) {
+  node->height = static_cast<std::int8_t>(
+      std::max(get_height(node->left), get_height(node->right)) + 1);
 }
 
-template <typename K, typename V>
-int AvlTree<K, V>::get_height(const Node<K, V>* node) const {
+template <typename K, typename KeyOf>
+int AvlTree<K, KeyOf>::get_height(const NodeBase* node) const {
   return node ? node->height : -1;
 }
 
-template <typename K, typename V>
-int AvlTree<K, V>::get_balance(const Node<K, V>* node) const {
+template <typename K, typename KeyOf>
+int AvlTree<K, KeyOf>::get_balance(const NodeBase* node) const {
   return get_height(node->left) - get_height(node->right);
 }
 
 /* ------------------- merge --------------------- */
 
-template <typename K, typename V>
-void AvlTree<K, V>::merge(AvlTree<K, V>& other) {
-  Node<K, V>* inserted_node{};
-  for (auto it = other.begin(); it != other.end();) {
-    inserted_node = insert(it->value);
-    if (inserted_node) {
-      inserted_node = it;
-      it = it->next_node();
-      if (other.size_ == 1) it = nullptr;
-      other.erase(inserted_node);
-    } else {
-      it = it->next_node();
-    }
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::merge(AvlTree<K, KeyOf>& other) {
+  for (NodeBase* node = other.begin(); node != other.end();) {
+    NodeBase* next = node->next_node();
+    if (insert(value_of(node))) other.erase(node);
+    node = next;
   };
 }
 
 /* ------------------ erase ---------------------- */
 
-template <typename K, typename V>
-void AvlTree<K, V>::erase(Node<K, V>* node) {
-  Node<K, V>* tmp = node;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::erase(NodeBase* node) {
+  delete static_cast<node_type*>(unlink(node));
+}
+
+// Takes the node out of the tree and rebalances it, the node itself is
+// returned with its links cleared.
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::unlink(NodeBase* node) {
   if (!node->left && !node->right) {
-    tmp = node->parent;
-    if (tmp->left && node->value == tmp->left->value)
-      tmp->left = nullptr;
-    else if (tmp->right && node->value == tmp->right->value)
-      tmp->right = nullptr;
-    balance_after_erase(tmp);
-    delete node;
-    node = nullptr;
+    NodeBase* parent = node->parent;
+    if (parent->left == node)
+      parent->left = nullptr;
+    else
+      parent->right = nullptr;
+    balance_after_erase(parent);
   } else if (!node->right) {
     swap_node(node, node->left);
-    node = node->parent;
-    node->height = 0;
-    delete node->left;
-    node->left = nullptr;
-    if (head_->parent) balance_after_erase(node);
+    NodeBase* parent = node->parent;
+    parent->height = 0;
+    parent->left = nullptr;
+    balance_after_erase(parent);
   } else if (!node->left) {
     swap_node(node, node->right);
-    node = node->parent;
-    node->height = 0;
-    delete node->right;
-    node->right = nullptr;
-    if (head_->parent) balance_after_erase(node);
+    NodeBase* parent = node->parent;
+    parent->height = 0;
+    parent->right = nullptr;
+    balance_after_erase(parent);
   } else {
-    // tmp = find_extremum(tmp, get_balance(tmp));
-    swap_node(node, find_extremum(tmp, get_balance(tmp)));
-    erase(node);
+    swap_node(node, find_extremum(node, get_balance(node)));
+    return unlink(node);
   }
+  node->parent = node->left = node->right = nullptr;
+  node->height = 0;
+  return node;
 }
 
-/* ---------------------- find ------------------------ */
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator AvlTree<K, KeyOf>::erase(
+    iterator pos) {
+  NodeBase* next = pos.iterator_node_->next_node();
+  erase(pos.iterator_node_);
+  return iterator{next};
+}
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::find(const K& key) {
-  Node<K, V>* tmp = head_;
-  if (head_) {
-    while (tmp) {
-      if (key < tmp->value)
-        tmp = tmp->left;
-      else if (key > tmp->value)
-        tmp = tmp->right;
-      else
-        break;
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator AvlTree<K, KeyOf>::erase(
+    iterator first, iterator last) {
+  erase_range(first.iterator_node_, last.iterator_node_);
+  return last;
+}
+
+// Removes [first, last) in O(k + log n): the tree is split around the range,
+// the k nodes are freed as a whole and the two remaining parts are joined.
+// Returns k.
+template <typename K, typename KeyOf>
+size_t AvlTree<K, KeyOf>::erase_range(NodeBase* first, NodeBase* last) {
+  size_t count{};
+  for (NodeBase* node = first; node != last; node = node->next_node())
+    ++count;
+  if (count == size_) {
+    clear();
+  } else if (count) {
+    std::pair<NodeBase*, NodeBase*> parts = split_before(first, head_);
+    NodeBase* before = parts.first;
+    NodeBase* range = parts.second;
+    NodeBase* after{};
+    if (last != end()) {
+      parts = split_before(last, range);
+      range = parts.first;
+      after = parts.second;
     }
-    if (!tmp) tmp = head_->parent;
+    delete_nodes(range);
+    if (after) {
+      NodeBase* pivot{};
+      after = take_min(after, pivot);
+      before = join(before, pivot, after);
+    }
+    set_root(before);
+    size_ -= count;
   }
-  return tmp;
+  return count;
 }
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::lower_bound(const K& key) {
-  Node<K, V>* tmp = head_;
-  Node<K, V>* res{};
-  if (head_) {
-    while (tmp) {
-      if (key < tmp->value) {
-        res = tmp;
-        tmp = tmp->left;
-      } else if (key > tmp->value) {
-        tmp = tmp->right;
-      } else {
-        res = tmp;
-        break;
-      }
+/* ---------------------- find ------------------------ */
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::find(const key_type& key) {
+  NodeBase* tmp = lower_bound(key);
+  return tmp != end() && !(key < KeyOf{}(value_of(tmp))) ? tmp : end();
+}
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::lower_bound(const key_type& key) {
+  NodeBase* res = end();
+  for (NodeBase* tmp = head_; tmp;) {
+    if (KeyOf{}(value_of(tmp)) < key) {
+      tmp = tmp->right;
+    } else {
+      res = tmp;
+      tmp = tmp->left;
+    }
+  }
+  return res;
+};
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::upper_bound(const key_type& key) {
+  NodeBase* res = end();
+  for (NodeBase* tmp = head_; tmp;) {
+    if (key < KeyOf{}(value_of(tmp))) {
+      res = tmp;
+      tmp = tmp->left;
+    } else {
+      tmp = tmp->right;
     }
   }
   return res;
 };
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::find_extremum(Node<K, V>* node, int balance) {
-  Node<K, V>* tmp{};
+// Calls fn(NodeBase *) with the node of every key, or end(), in the order of
+// keys. The keys are looked up kBatchLanes at a time: each round moves every
+// unfinished lookup one level down and prefetches the node it lands on, so
+// the cache misses of the lanes overlap instead of following one another.
+template <typename K, typename KeyOf>
+template <typename Keys, typename Fn>
+void AvlTree<K, KeyOf>::find_batch(const Keys& keys, Fn fn) {
+  const key_type* lane_key[kBatchLanes];
+  NodeBase* lane_node[kBatchLanes];
+  NodeBase* lane_found[kBatchLanes];
+  for (auto it = keys.begin(); it != keys.end();) {
+    size_t lanes{};
+    for (; lanes < kBatchLanes && it != keys.end(); ++it, ++lanes) {
+      lane_key[lanes] = &*it;
+      lane_node[lanes] = head_;
+      lane_found[lanes] = end();
+    }
+    for (bool pending = head_; pending;) {
+      pending = false;
+      for (size_t i = 0; i < lanes; ++i) {
+        NodeBase* node = lane_node[i];
+        if (!node) continue;
+        if (KeyOf{}(value_of(node)) < *lane_key[i]) {
+          node = node->right;
+        } else {
+          lane_found[i] = node;
+          node = node->left;
+        }
+        if (node) {
+          __builtin_prefetch(node);
+          __builtin_prefetch(&value_of(node));
+          pending = true;
+        }
+        lane_node[i] = node;
+      }
+    }
+    for (size_t i = 0; i < lanes; ++i) {
+      NodeBase* node = lane_found[i];
+      bool found = node != end() && !(*lane_key[i] < KeyOf{}(value_of(node)));
+      fn(found ? node : end());
+    }
+  }
+}
+
+// Calls fn with the nodes b0 = begin(), b1, ..., bk = end() in order, such
+// that the ranges [b(i), b(i+1)) cover the tree, about parts of them and of
+// similar sizes. The inner boundaries are the nodes of the top levels, so a
+// range is one subtree below them plus its boundary node, and the first one
+// may be empty.
+template <typename K, typename KeyOf>
+template <typename Fn>
+void AvlTree<K, KeyOf>::split(size_t parts, Fn fn) {
+  size_t levels{};
+  while (levels < 64 && (size_t{1} << levels) < parts) ++levels;
+  fn(begin());
+  split_points(head_, levels, fn);
+  fn(end());
+}
+
+template <typename K, typename KeyOf>
+template <typename Fn>
+void AvlTree<K, KeyOf>::split_points(NodeBase* node, size_t levels, Fn& fn) {
+  if (!node || !levels) return;
+  split_points(node->left, levels - 1, fn);
+  fn(node);
+  split_points(node->right, levels - 1, fn);
+}
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::find_extremum(NodeBase* node, int balance) {
+  NodeBase* tmp{};
   if (balance < 0) {
     tmp = node->right;
     while (tmp->left) tmp = tmp->left;
@@ -268,35 +448,194 @@ Node<K, V>* AvlTree<K, V>::find_extremum(Node<K, V>* node, int balance) {
   return tmp;
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::balance_after_erase(Node<K, V>* node) {
-  while (node->parent->parent != head_) {
-    update_height(node);
-    balance(node, get_balance(node));
-    node = node->parent;
-  }
-  if (size_ == 1) {
-    delete head_->parent;
-    head_ = nullptr;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::balance_after_erase(NodeBase* node) {
+  if (size_ > 1) {
+    while (true) {
+      update_height(node);
+      balance(node, get_balance(node));
+      if (node == head_) break;
+      node = node->parent;
+    }
   }
+  if (size_ == 1) set_root(nullptr);
   --size_;
 }
 
+/* ------------------- SPLIT AND JOIN --------------------- */
+
+// The helpers below work on detached subtrees: they return the new subtree
+// root, whose parent link is left for the caller to set.
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::subtree_left_rotate(NodeBase* node) {
+  NodeBase* root = node->right;
+  node->right = root->left;
+  if (node->right) node->right->parent = node;
+  root->left = node;
+  node->parent = root;
+  update_height(node);
+  update_height(root);
+  return root;
+}
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::subtree_right_rotate(NodeBase* node) {
+  NodeBase* root = node->left;
+  node->left = root->right;
+  if (node->left) node->left->parent = node;
+  root->right = node;
+  node->parent = root;
+  update_height(node);
+  update_height(root);
+  return root;
+}
+
+// Children heights may differ by two at most.
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::subtree_balance(NodeBase* node) {
+  update_height(node);
+  int diff = get_balance(node);
+  if (diff > 1) {
+    if (get_balance(node->left) < 0) {
+      node->left = subtree_left_rotate(node->left);
+      node->left->parent = node;
+    }
+    node = subtree_right_rotate(node);
+  } else if (diff < -1) {
+    if (get_balance(node->right) > 0) {
+      node->right = subtree_right_rotate(node->right);
+      node->right->parent = node;
+    }
+    node = subtree_left_rotate(node);
+  }
+  return node;
+}
+
+// All of left, then pivot, then all of right, in O(|height difference|).
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::join(NodeBase* left, NodeBase* pivot,
+                                       NodeBase* right) {
+  NodeBase* root{};
+  if (get_height(left) > get_height(right) + 1) {
+    root = join_right(left, pivot, right);
+  } else if (get_height(right) > get_height(left) + 1) {
+    root = join_left(left, pivot, right);
+  } else {
+    pivot->left = left;
+    pivot->right = right;
+    if (left) left->parent = pivot;
+    if (right) right->parent = pivot;
+    update_height(pivot);
+    root = pivot;
+  }
+  root->parent = nullptr;
+  return root;
+}
+
+// Hangs pivot and right off the right spine of the taller left tree.
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::join_right(NodeBase* left,
+                                             NodeBase* pivot,
+                                             NodeBase* right) {
+  NodeBase* spine{};
+  if (get_height(left->right) <= get_height(right) + 1) {
+    pivot->left = left->right;
+    pivot->right = right;
+    if (pivot->left) pivot->left->parent = pivot;
+    if (right) right->parent = pivot;
+    spine = subtree_balance(pivot);
+  } else {
+    spine = join_right(left->right, pivot, right);
+  }
+  left->right = spine;
+  spine->parent = left;
+  return subtree_balance(left);
+}
+
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::join_left(NodeBase* left,
+                                            NodeBase* pivot,
+                                            NodeBase* right) {
+  NodeBase* spine{};
+  if (get_height(right->left) <= get_height(left) + 1) {
+    pivot->right = right->left;
+    pivot->left = left;
+    if (pivot->right) pivot->right->parent = pivot;
+    if (left) left->parent = pivot;
+    spine = subtree_balance(pivot);
+  } else {
+    spine = join_left(left, pivot, right->left);
+  }
+  right->left = spine;
+  spine->parent = right;
+  return subtree_balance(right);
+}
+
+// Splits the subtree under root into the nodes before node and node with
+// everything after it. Climbing from node, each ancestor and its other
+// subtree are joined to the side they belong to; the joins cost O(log n)
+// together.
+template <typename K, typename KeyOf>
+std::pair<NodeBase*, NodeBase*> AvlTree<K, KeyOf>::split_before(
+    NodeBase* node, NodeBase* root) {
+  NodeBase* before = node->left;
+  NodeBase* after = node->right;
+  if (before) before->parent = nullptr;
+  if (after) after->parent = nullptr;
+  NodeBase* child = node;
+  NodeBase* parent = node == root ? nullptr : node->parent;
+  after = join(nullptr, node, after);
+  while (parent) {
+    bool from_right = parent->right == child;
+    child = parent;
+    NodeBase* next = parent == root ? nullptr : parent->parent;
+    NodeBase* other = from_right ? parent->left : parent->right;
+    if (other) other->parent = nullptr;
+    if (from_right)
+      before = join(other, parent, before);
+    else
+      after = join(after, parent, other);
+    parent = next;
+  }
+  return {before, after};
+}
+
+// Detaches the smallest node of a subtree, returns the rest.
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::take_min(NodeBase* root, NodeBase*& min) {
+  if (!root->left) {
+    min = root;
+    if (root->right) root->right->parent = nullptr;
+    return root->right;
+  }
+  root->left = take_min(root->left, min);
+  if (root->left) root->left->parent = root;
+  root = subtree_balance(root);
+  root->parent = nullptr;
+  return root;
+}
+
 /* -------------------- COPY AND SWAP ---------------------- */
 
-template <typename K, typename V>
-AvlTree<K, V>& AvlTree<K, V>::copy_tree(Node<K, V>* node,
-                                        const Node<K, V>* other_node) {
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::clone_node(const NodeBase* other_node) {
+  NodeBase* node = new node_type{value_of(other_node)};
+  node->height = other_node->height;
+  return node;
+}
+
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>& AvlTree<K, KeyOf>::copy_tree(NodeBase* node,
+                                        const NodeBase* other_node) {
   if (other_node) {
     if (other_node->left) {
-      node->left =
-          new Node<K, V>{other_node->left->value, other_node->left->height};
+      node->left = clone_node(other_node->left);
       node->left->parent = node;
       copy_tree(node->left, other_node->left);
     }
     if (other_node->right) {
-      node->right =
-          new Node<K, V>{other_node->right->value, other_node->right->height};
+      node->right = clone_node(other_node->right);
       node->right->parent = node;
       copy_tree(node->right, other_node->right);
     }
@@ -304,16 +643,18 @@ AvlTree<K, V>& AvlTree<K, V>::copy_tree(Node<K, V>* node,
   return *this;
 }
 
-template <typename K, typename V>
-AvlTree<K, V>& AvlTree<K, V>::swap_tree(AvlTree<K, V>&& other_tree) {
-  std::swap(head_, other_tree.head_);
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>& AvlTree<K, KeyOf>::swap_tree(AvlTree&& other_tree) {
+  NodeBase* root = head_;
+  set_root(other_tree.head_);
+  other_tree.set_root(root);
   std::swap(size_, other_tree.size_);
   other_tree.clear();
   return *this;
 }
 
-template <typename K, typename V>
-void AvlTree<K, V>::swap_node(Node<K, V>* one, Node<K, V>* two) {
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::swap_node(NodeBase* one, NodeBase* two) {
   if (two->left) two->left->parent = one;
   if (two->right) two->right->parent = one;
   if (one->left == two || one->right == two) {
@@ -361,27 +702,31 @@ void AvlTree<K, V>::swap_node(Node<K, V>* one, Node<K, V>* two) {
 
 /* ---------------------- CAPACITY --------------------------- */
 
-template <typename K, typename V>
-bool AvlTree<K, V>::empty() const {
+template <typename K, typename KeyOf>
+bool AvlTree<K, KeyOf>::empty() const {
   return !head_;
 };
 
-template <typename K, typename V>
-size_t AvlTree<K, V>::get_size() const {
+template <typename K, typename KeyOf>
+size_t AvlTree<K, KeyOf>::get_size() const {
   return size_;
 };
 
-template <typename K, typename V>
-size_t AvlTree<K, V>::max_size() const {
-  return (std::numeric_limits<size_t>::max() / 2) / sizeof(V) / 10;
+// Reported the way the standard trees do, for a node that keeps the value
+// after the padded links.
+template <typename K, typename KeyOf>
+size_t AvlTree<K, KeyOf>::max_size() const {
+  return (std::numeric_limits<size_t>::max() / 2) /
+         sizeof(std::pair<NodeBase, K>);
 };
 
 /* -------------------- begin AND end ------------------------- */
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::begin() {
-  Node<K, V>* tmp = head_;
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::begin() {
+  NodeBase* tmp = end();
   if (head_) {
+    tmp = head_;
     while (tmp->left) {
       tmp = tmp->left;
     }
@@ -389,54 +734,65 @@ Node<K, V>* AvlTree<K, V>::begin() {
   return tmp;
 };
 
-template <typename K, typename V>
-Node<K, V>* AvlTree<K, V>::end() {
-  return head_ ? head_->parent : nullptr;
+template <typename K, typename KeyOf>
+NodeBase* AvlTree<K, KeyOf>::end() {
+  return &end_;
 };
 
-template <typename K, typename V>
-void AvlTree<K, V>::create_end() {
-  Node<K, V>* tmp = new Node<K, V>{head_->value, -1};
-  tmp->parent = head_;
-  head_->parent = tmp;
+template <typename K, typename KeyOf>
+void AvlTree<K, KeyOf>::set_root(NodeBase* root) {
+  head_ = root;
+  end_.parent = root;
+  if (root) root->parent = &end_;
+}
+
+template <typename K, typename KeyOf>
+K& AvlTree<K, KeyOf>::value_of(NodeBase* node) {
+  return static_cast<node_type*>(node)->value;
+}
+
+template <typename K, typename KeyOf>
+const K& AvlTree<K, KeyOf>::value_of(const NodeBase* node) {
+  return static_cast<const node_type*>(node)->value;
 }
 
 /* ------------------------ NODE ------------------------------ */
 
-template <typename K, typename V>
-Node<K, V>::Node() : value{}, height{} {};
+template <typename K>
+Node<K>::Node(const K& o_value) : value{o_value} {};
 
-template <typename K, typename V>
-Node<K, V>::Node(K o_value, int o_height) : value{o_value}, height{o_height} {};
+template <typename K>
+template <typename... Args>
+Node<K>::Node(std::in_place_t, Args&&... args)
+    : value(std::forward<Args>(args)...){};
 
-template <typename K, typename V>
-Node<K, V>* Node<K, V>::next_node() {
-  Node<K, V>* node = this;
+// The successor is found from the links alone: the leftmost node of the
+// right subtree, or the first ancestor reached from a left child. The root
+// hangs off the end sentinel whose children are empty, so climbing from the
+// last node stops at the sentinel.
+inline NodeBase* NodeBase::next_node() {
+  NodeBase* node = this;
   if (node->right) {
     node = node->right;
     while (node->left) node = node->left;
   } else {
-    while (node->parent->parent != node && node->parent->value < node->value) {
-      node = node->parent;
-    }
+    while (node->parent->right == node) node = node->parent;
     node = node->parent;
   }
   return node;
 }
 
-template <typename K, typename V>
-Node<K, V>* Node<K, V>::previous_node() {
-  Node<K, V>* node = this;
-  if (node->parent->parent == node && node->height == -1) {
-    node = node->parent;
+// Stepping back from the sentinel of an empty tree stays on it.
+inline NodeBase* NodeBase::previous_node() {
+  NodeBase* node = this;
+  if (node->height == -1) {
+    if (node->parent) node = node->parent;
     while (node->right) node = node->right;
   } else if (node->left) {
     node = node->left;
     while (node->right) node = node->right;
   } else {
-    while (node->parent->value > node->value) {
-      node = node->parent;
-    }
+    while (node->parent->left == node) node = node->parent;
     node = node->parent;
   }
   return node;
@@ -444,84 +800,84 @@ Node<K, V>* Node<K, V>::previous_node() {
 
 /* ---------------------------- ITERATOR ------------------------------ */
 
-template <typename K, typename V>
-AvlTree<K, V>::Iterator::Iterator() : iterator_node_{nullptr} {};
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::Iterator::Iterator() : iterator_node_{nullptr} {};
 
-template <typename K, typename V>
-AvlTree<K, V>::Iterator::Iterator(node_type* node) : iterator_node_{node} {};
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::Iterator::Iterator(NodeBase* node)
+    : iterator_node_{node} {};
 
-template <typename K, typename V>
-AvlTree<K, V>::Iterator::Iterator(const iterator& other)
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::Iterator::Iterator(const iterator& other)
     : iterator_node_{other.iterator_node_} {};
 
-template <typename K, typename V>
-AvlTree<K, V>::Iterator::Iterator(iterator&& other)
+template <typename K, typename KeyOf>
+AvlTree<K, KeyOf>::Iterator::Iterator(iterator&& other)
     : iterator_node_{other.iterator_node_} {
   other.iterator_node_ = nullptr;
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator& AvlTree<K, V>::iterator::operator=(
-    const iterator& it) {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator&
+AvlTree<K, KeyOf>::iterator::operator=(const iterator& it) {
   iterator_node_ = it.iterator_node_;
   return *this;
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator& AvlTree<K, V>::iterator::operator=(
-    iterator&& it) {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator&
+AvlTree<K, KeyOf>::iterator::operator=(iterator&& it) {
   iterator_node_ = it.iterator_node_;
   it.iterator_node_ = nullptr;
   return *this;
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator AvlTree<K, V>::iterator::operator++(int) {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator
+AvlTree<K, KeyOf>::iterator::operator++(int) {
   iterator tmp = *this;
   operator++();
   return tmp;
 };
 
-template <typename K, typename V>
-bool AvlTree<K, V>::iterator::operator!=(const iterator& it) {
+template <typename K, typename KeyOf>
+bool AvlTree<K, KeyOf>::iterator::operator!=(const iterator& it) {
   return iterator_node_ != it.iterator_node_;
 };
 
-template <typename K, typename V>
-bool AvlTree<K, V>::iterator::operator==(const iterator& it) {
+template <typename K, typename KeyOf>
+bool AvlTree<K, KeyOf>::iterator::operator==(const iterator& it) {
   return iterator_node_ == it.iterator_node_;
 };
 
-template <typename K, typename V>
-K& AvlTree<K, V>::iterator::operator*() {
-  if (iterator_node_) return iterator_node_->value;
-  static K empty_value{};
-  return empty_value;
+template <typename K, typename KeyOf>
+K& AvlTree<K, KeyOf>::iterator::operator*() {
+  return value_of(iterator_node_);
 };
 
-template <typename K, typename V>
-const K& AvlTree<K, V>::const_iterator::operator*() {
-  if (const_iterator::iterator_node_)
-    return const_iterator::iterator_node_->value;
-  static K empty_value{};
-  return empty_value;
+template <typename K, typename KeyOf>
+const K& AvlTree<K, KeyOf>::const_iterator::operator*() {
+  return value_of(const_iterator::iterator_node_);
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator AvlTree<K, V>::iterator::operator--(int) {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator
+AvlTree<K, KeyOf>::iterator::operator--(int) {
   iterator tmp = *this;
   operator--();
   return tmp;
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator& AvlTree<K, V>::iterator::operator++() {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator&
+AvlTree<K, KeyOf>::iterator::operator++() {
   if (iterator_node_) iterator_node_ = iterator_node_->next_node();
   return *this;
 };
 
-template <typename K, typename V>
-typename AvlTree<K, V>::iterator& AvlTree<K, V>::iterator::operator--() {
+template <typename K, typename KeyOf>
+typename AvlTree<K, KeyOf>::iterator&
+AvlTree<K, KeyOf>::iterator::operator--() {
   if (iterator_node_) iterator_node_ = iterator_node_->previous_node();
   return *this;
 };
@@ -0,0 +1,25 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_KEY_OF_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_KEY_OF_H_
+
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Extracts the ordering key from a stored value: set-like containers order by
+// the value itself, map-like containers by the first element of the pair.
+template <typename Value>
+struct SetKeyOf {
+  using key_type = Value;
+  const key_type& operator()(const Value& value) const { return value; }
+};
+
+template <typename Pair>
+struct MapKeyOf {
+  using key_type = std::remove_const_t<typename Pair::first_type>;
+  const key_type& operator()(const Pair& value) const { return value.first; }
+};
+
+};  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_KEY_OF_H_
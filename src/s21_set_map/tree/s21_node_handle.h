@@ -0,0 +1,67 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_NODE_HANDLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_NODE_HANDLE_H_
+
+#include <utility>
+
+namespace s21 {
+
+struct NodeBase;
+
+template <typename K>
+struct Node;
+
+template <typename K, typename KeyOf>
+class AvlTree;
+
+// Owns a node taken out of an AvlTree by extract. The value stays where it
+// was allocated, so handing the node to another tree of the same type moves
+// the element without copying or reallocating it. An empty handle owns
+// nothing, a non-empty one deletes its node unless it is inserted again.
+template <typename V>
+class NodeHandle {
+ public:
+  using value_type = V;
+
+  NodeHandle() noexcept : node_{} {};
+  NodeHandle(NodeHandle&& other) noexcept : node_{other.node_} {
+    other.node_ = nullptr;
+  };
+  NodeHandle(const NodeHandle&) = delete;
+  ~NodeHandle() { delete node_; };
+
+  NodeHandle& operator=(NodeHandle&& other) noexcept {
+    std::swap(node_, other.node_);
+    return *this;
+  };
+  NodeHandle& operator=(const NodeHandle&) = delete;
+
+  bool empty() const noexcept { return !node_; };
+  explicit operator bool() const noexcept { return node_; };
+
+  V& value() const { return node_->value; };
+
+  // For map elements. The key is a const member of the stored pair, so it
+  // cannot be changed while the node is out of the tree either.
+  template <typename Pair = V>
+  const typename Pair::first_type& key() const {
+    return node_->value.first;
+  };
+  template <typename Pair = V>
+  typename Pair::second_type& mapped() const {
+    return node_->value.second;
+  };
+
+  void swap(NodeHandle& other) noexcept { std::swap(node_, other.node_); };
+
+ private:
+  template <typename, typename>
+  friend class AvlTree;
+
+  explicit NodeHandle(Node<V>* node) noexcept : node_{node} {};
+
+  Node<V>* node_;
+};
+
+};  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_SET_MAP_TREE_S21_NODE_HANDLE_H_
@@ -0,0 +1,66 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ALIGNED_ARRAY_S21_ALIGNED_ARRAY_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ALIGNED_ARRAY_S21_ALIGNED_ARRAY_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// A fixed-size array for SIMD kernels. data() is aligned to Align bytes and
+// the storage is padded up to a whole number of Align-byte vectors, so a
+// kernel can run over padded_size() elements with aligned loads and without
+// a scalar epilogue. The padding holds value_type{}, zero for arithmetic
+// types, and stays that way unless a kernel writes to it.
+template <typename T, size_t N, size_t Align = 64>
+class aligned_array {
+  static_assert(Align && !(Align & (Align - 1)),
+                "the alignment has to be a power of two");
+  static_assert(Align >= alignof(T) && Align % sizeof(T) == 0,
+                "the alignment has to be a multiple of the element size");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  static constexpr size_type alignment = Align;
+
+  constexpr aligned_array() = default;
+  constexpr aligned_array(std::initializer_list<value_type> const &items);
+
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+  constexpr reference front();
+  constexpr const_reference front() const;
+  constexpr reference back();
+  constexpr const_reference back() const;
+  constexpr iterator data() noexcept;
+  constexpr const_iterator data() const noexcept;
+  constexpr iterator begin() noexcept;
+  constexpr const_iterator begin() const noexcept;
+  constexpr iterator end() noexcept;
+  constexpr const_iterator end() const noexcept;
+
+  constexpr bool empty() const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr size_type padded_size() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  constexpr void swap(aligned_array &other);
+  constexpr void fill(const_reference value);
+
+ private:
+  static constexpr size_type kLanes = Align / sizeof(T);
+  static constexpr size_type kPadded = (N + kLanes - 1) / kLanes * kLanes;
+
+  alignas(Align) value_type arr_[kPadded ? kPadded : 1]{};
+};
+};  // namespace s21
+
+#include "s21_aligned_array.tpp"
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ALIGNED_ARRAY_S21_ALIGNED_ARRAY_H_
@@ -0,0 +1,148 @@
+namespace s21 {
+
+/* ---------------- CONSTRUCTORS ------------------ */
+
+template <typename T, size_t N, size_t Align>
+constexpr aligned_array<T, N, Align>::aligned_array(
+    std::initializer_list<value_type> const &items)
+    : arr_{} {
+  if (items.size() > N) {
+    throw std::out_of_range("too many initializers for aligned_array");
+  }
+  size_type i = 0;
+  for (const auto &item : items) arr_[i++] = item;
+}
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+// The padding is value_type{} on both sides and is left alone.
+template <typename T, size_t N, size_t Align>
+constexpr void aligned_array<T, N, Align>::swap(aligned_array &other) {
+  for (size_type i = 0; i < N; ++i) {
+    value_type tmp = std::move(arr_[i]);
+    arr_[i] = std::move(other.arr_[i]);
+    other.arr_[i] = std::move(tmp);
+  }
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr void aligned_array<T, N, Align>::fill(const_reference value) {
+  for (size_type i = 0; i < N; ++i) arr_[i] = value;
+}
+
+/* ---------------------------- ITERATORS ------------------------------ */
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::iterator
+aligned_array<T, N, Align>::begin() noexcept {
+  return arr_;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_iterator
+aligned_array<T, N, Align>::begin() const noexcept {
+  return arr_;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::iterator
+aligned_array<T, N, Align>::end() noexcept {
+  return arr_ + N;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_iterator
+aligned_array<T, N, Align>::end() const noexcept {
+  return arr_ + N;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::iterator
+aligned_array<T, N, Align>::data() noexcept {
+  return arr_;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_iterator
+aligned_array<T, N, Align>::data() const noexcept {
+  return arr_;
+}
+
+/* ---------------------------- ACCESS ------------------------------ */
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::reference
+aligned_array<T, N, Align>::operator[](size_type pos) {
+  return arr_[pos];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_reference
+aligned_array<T, N, Align>::operator[](size_type pos) const {
+  return arr_[pos];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::reference
+aligned_array<T, N, Align>::at(size_type pos) {
+  if (pos >= N) throw std::out_of_range("Index out of range");
+  return arr_[pos];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_reference
+aligned_array<T, N, Align>::at(size_type pos) const {
+  if (pos >= N) throw std::out_of_range("Index out of range");
+  return arr_[pos];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::reference
+aligned_array<T, N, Align>::front() {
+  return arr_[0];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_reference
+aligned_array<T, N, Align>::front() const {
+  return arr_[0];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::reference
+aligned_array<T, N, Align>::back() {
+  return arr_[N - 1];
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_reference
+aligned_array<T, N, Align>::back() const {
+  return arr_[N - 1];
+}
+
+/* ---------------------------- CAPACITY ------------------------- */
+
+template <typename T, size_t N, size_t Align>
+constexpr bool aligned_array<T, N, Align>::empty() const noexcept {
+  return N == 0;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::size_type
+aligned_array<T, N, Align>::size() const noexcept {
+  return N;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::size_type
+aligned_array<T, N, Align>::padded_size() const noexcept {
+  return kPadded;
+}
+
+template <typename T, size_t N, size_t Align>
+constexpr typename aligned_array<T, N, Align>::size_type
+aligned_array<T, N, Align>::max_size() const noexcept {
+  return N;
+}
+
+};  // namespace s21
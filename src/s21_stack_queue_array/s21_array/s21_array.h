@@ -1,6 +1,20 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ARRAY_S21_ARRAY_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ARRAY_S21_ARRAY_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 namespace s21 {
+// A fixed-size array. Every member is constexpr, so a table can be filled
+// in by a constexpr function and end up in read-only data. The copy and move
+// operations are the defaulted ones: an Array of a trivially copyable T is
+// trivially copyable itself and is copied with a single memcpy. A default
+// constructed Array leaves its elements uninitialized like std::array does,
+// Array<T, N> a{} value-initializes them, which is also what a constant
+// expression needs.
 template <typename T, size_t N>
 class Array {
  public:
@@ -11,20 +25,25 @@ class Array {
   using const_iterator = const T *;
   using size_type = size_t;
 
-  Array();
-  Array(std::initializer_list<value_type> const &items);
-  Array(const Array &a);
-  Array(Array &&a);
+  Array() = default;
+  constexpr Array(std::initializer_list<value_type> const &items);
+  Array(const Array &a) = default;
+  Array(Array &&a) = default;
   ~Array() = default;
 
-  Array<T, N> &operator=(const Array &a);
-  Array<T, N> &operator=(Array &&a);
+  Array<T, N> &operator=(const Array &a) = default;
+  Array<T, N> &operator=(Array &&a) = default;
 
   constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
   constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
   constexpr reference front();
+  constexpr const_reference front() const;
   constexpr reference back();
+  constexpr const_reference back() const;
   constexpr iterator data() noexcept;
+  constexpr const_iterator data() const noexcept;
   constexpr iterator begin() noexcept;
   constexpr const_iterator begin() const noexcept;
   constexpr iterator end() noexcept;
@@ -33,13 +52,15 @@ class Array {
   constexpr bool empty() const noexcept;
   constexpr size_type size() const noexcept;
   constexpr size_type max_size() const noexcept;
-  void swap(Array &other);
-  void fill(const_reference value);
+  constexpr void swap(Array &other);
+  constexpr void fill(const_reference value);
 
  private:
+  static constexpr size_type kWholeSwapBytes = 4096;
+
   value_type arr_[N];
 };
 };  // namespace s21
 
 #include "s21_array.tpp"
-#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ARRAY_S21_ARRAY_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_ARRAY_S21_ARRAY_H_
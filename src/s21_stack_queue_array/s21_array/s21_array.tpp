@@ -2,59 +2,41 @@ namespace s21 {
 
 /* ---------------- CONSTRUCTORS ------------------ */
 
+// Elements past the end of the list are value-initialized.
 template <typename T, size_t N>
-Array<T, N>::Array() {}
-
-template <typename T, size_t N>
-Array<T, N>::Array(std::initializer_list<value_type> const &items) {
+constexpr Array<T, N>::Array(std::initializer_list<value_type> const &items)
+    : arr_{} {
   if (items.size() > N) {
     throw std::out_of_range("too many initializers for Array");
   }
-  std::copy(items.begin(), items.end(), begin());
-  // fill 0, if items.size() > size()
-  std::fill(begin() + items.size(), end(), 0);
-}
-
-template <typename T, size_t N>
-Array<T, N>::Array(const Array &a) {
-  std::copy(a.begin(), a.end(), begin());
-}
-
-template <typename T, size_t N>
-Array<T, N>::Array(Array &&other) {
-  std::move(other.begin(), other.end(), begin());
-}
-
-/* ------------------------ OPERATORS --------------------------- */
-
-template <typename T, size_t N>
-Array<T, N> &Array<T, N>::operator=(const Array &a) {
-  if (this != &a) {
-    std::copy(a.begin(), a.end(), begin());
-  }
-
-  return *this;
-}
-
-template <typename T, size_t N>
-Array<T, N> &Array<T, N>::operator=(Array &&a) {
-  if (this != &a) {
-    std::move(a.begin(), a.end(), begin());
-  }
-
-  return *this;
+  size_type i = 0;
+  for (const auto &item : items) arr_[i++] = item;
 }
 
 /* ------------------------- MODIFIRE ---------------------------- */
 
-template <typename T, size_t N>
-void Array<T, N>::swap(Array &other) {
-  std::swap_ranges(other.begin(), other.end(), begin());
+// A small trivially copyable Array is swapped as a whole, through three
+// memcpy. A large one goes element by element like the others: a copy of it
+// on the stack costs more than it saves.
+template <typename T, size_t N>
+constexpr void Array<T, N>::swap(Array &other) {
+  if constexpr (std::is_trivially_copyable_v<value_type> &&
+                sizeof(value_type) * N <= kWholeSwapBytes) {
+    Array tmp = other;
+    other = *this;
+    *this = tmp;
+  } else {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp = std::move(arr_[i]);
+      arr_[i] = std::move(other.arr_[i]);
+      other.arr_[i] = std::move(tmp);
+    }
+  }
 }
 
 template <typename T, size_t N>
-void Array<T, N>::fill(const_reference value) {
-  std::fill(begin(), end(), value);
+constexpr void Array<T, N>::fill(const_reference value) {
+  for (size_type i = 0; i < N; ++i) arr_[i] = value;
 }
 
 /* ---------------------------- ITERATORS ------------------------------ */
@@ -86,6 +68,12 @@ constexpr typename Array<T, N>::iterator Array<T, N>::data() noexcept {
   return arr_;
 }
 
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_iterator Array<T, N>::data()
+    const noexcept {
+  return arr_;
+}
+
 /* ---------------------------- ACCESS ------------------------------ */
 
 template <typename T, size_t N>
@@ -94,6 +82,12 @@ constexpr typename Array<T, N>::reference Array<T, N>::operator[](
   return arr_[pos];
 }
 
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_reference Array<T, N>::operator[](
+    size_type pos) const {
+  return arr_[pos];
+}
+
 template <typename T, size_t N>
 constexpr typename Array<T, N>::reference Array<T, N>::at(size_type pos) {
   if (pos >= size()) {
@@ -103,14 +97,34 @@ constexpr typename Array<T, N>::reference Array<T, N>::at(size_type pos) {
   return arr_[pos];
 }
 
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_reference Array<T, N>::at(
+    size_type pos) const {
+  if (pos >= size()) {
+    throw std::out_of_range("Index out of range");
+  }
+
+  return arr_[pos];
+}
+
 template <typename T, size_t N>
 constexpr typename Array<T, N>::reference Array<T, N>::front() {
-  return *begin();
+  return arr_[0];
+}
+
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_reference Array<T, N>::front() const {
+  return arr_[0];
 }
 
 template <typename T, size_t N>
 constexpr typename Array<T, N>::reference Array<T, N>::back() {
-  return *(end() - 1);
+  return arr_[N - 1];
+}
+
+template <typename T, size_t N>
+constexpr typename Array<T, N>::const_reference Array<T, N>::back() const {
+  return arr_[N - 1];
 }
 
 /* ---------------------------- CAPACITY ------------------------- */
@@ -0,0 +1,128 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_BLOCKING_QUEUE_S21_BLOCKING_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_BLOCKING_QUEUE_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "../s21_queue/s21_queue.h"
+
+namespace s21 {
+
+// FIFO for any number of producer and consumer threads: an s21::Queue
+// behind one mutex, with condition variables to sleep on instead of
+// polling. A bounded queue makes push wait while it is full, so producers
+// are slowed down to the pace of the consumers.
+//
+// push_bulk and drain move whole batches under a single lock acquisition and
+// wake the other side once per batch, which is where most of the throughput
+// of a busy queue is won back.
+//
+// close() ends the stream: pushes fail from then on, threads waiting to
+// push return false, and pops keep returning what is left until the queue
+// is empty, then return false instead of waiting.
+template <typename T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // a capacity of 0 is taken as 1
+  explicit blocking_queue(
+      size_type capacity = std::numeric_limits<size_type>::max());
+  blocking_queue(const blocking_queue &q) = delete;
+  blocking_queue(blocking_queue &&q) = delete;
+  ~blocking_queue() = default;
+
+  blocking_queue &operator=(const blocking_queue &q) = delete;
+  blocking_queue &operator=(blocking_queue &&q) = delete;
+
+  // Exact only while no thread is pushing or popping, otherwise a snapshot.
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  void close();
+  bool closed() const;
+
+  // Wait while the queue is full. false if it is closed, value is then left
+  // untouched.
+  bool push(const_reference value);
+  bool push(value_type &&value);
+  template <class... Args>
+  bool emplace(Args &&...args);
+  template <class Rep, class Period>
+  bool push_for(const_reference value,
+                const std::chrono::duration<Rep, Period> &timeout);
+  template <class Rep, class Period>
+  bool push_for(value_type &&value,
+                const std::chrono::duration<Rep, Period> &timeout);
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+
+  // Wait while the queue is empty. false once it is closed and empty.
+  bool pop(reference value);
+  template <class Rep, class Period>
+  bool pop_for(reference value,
+               const std::chrono::duration<Rep, Period> &timeout);
+  bool try_pop(reference value);
+
+  // Pushes [first, last), waiting for room whenever the queue fills up.
+  // Returns where it stopped, which is before last only if the queue was
+  // closed.
+  template <typename InputIt>
+  InputIt push_bulk(InputIt first, InputIt last);
+  // Waits for at least one element, then moves up to max_n of them to out
+  // in FIFO order. Returns how many, 0 once the queue is closed and empty.
+  template <typename OutputIt>
+  size_type drain(OutputIt out, size_type max_n);
+  // drain without the wait
+  template <typename OutputIt>
+  size_type try_drain(OutputIt out, size_type max_n);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  bool has_room() const;
+  // Waits on cv until ready() holds or the queue is closed, or past
+  // deadline unless it is null. waiters counts the threads asleep on cv.
+  template <typename Pred>
+  void wait(std::unique_lock<std::mutex> &lock, std::condition_variable &cv,
+            size_type &waiters, Pred ready,
+            const Clock::time_point *deadline);
+  // Unlocks, then wakes as many waiters on cv as there are new elements or
+  // free slots.
+  static void notify(std::unique_lock<std::mutex> &lock,
+                     std::condition_variable &cv, size_type waiters,
+                     size_type count);
+
+  template <class... Args>
+  bool emplace_locked(std::unique_lock<std::mutex> &lock, Args &&...args);
+  bool pop_locked(std::unique_lock<std::mutex> &lock, reference value);
+  template <typename OutputIt>
+  size_type drain_locked(std::unique_lock<std::mutex> &lock, OutputIt out,
+                         size_type max_n);
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  Queue<T> queue_;
+  size_type capacity_;
+  // threads asleep in a push and in a pop, so that nobody is signalled when
+  // no one waits
+  size_type pushers_;
+  size_type poppers_;
+  bool closed_;
+};
+};  // namespace s21
+
+#include "s21_blocking_queue.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_BLOCKING_QUEUE_S21_BLOCKING_QUEUE_H_
@@ -0,0 +1,243 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename value_type>
+blocking_queue<value_type>::blocking_queue(size_type capacity)
+    : capacity_{capacity ? capacity : 1},
+      pushers_{0},
+      poppers_{0},
+      closed_{false} {};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename value_type>
+bool blocking_queue<value_type>::empty() const {
+  return !size();
+};
+
+template <typename value_type>
+typename blocking_queue<value_type>::size_type
+blocking_queue<value_type>::size() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  return queue_.size();
+};
+
+template <typename value_type>
+typename blocking_queue<value_type>::size_type
+blocking_queue<value_type>::capacity() const {
+  return capacity_;
+};
+
+/* ------------------- CLOSING --------------------- */
+
+template <typename value_type>
+void blocking_queue<value_type>::close() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    closed_ = true;
+  }
+  not_full_.notify_all();
+  not_empty_.notify_all();
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::closed() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  return closed_;
+};
+
+/* ------------------- PUSH --------------------- */
+
+template <typename value_type>
+bool blocking_queue<value_type>::push(const_reference value) {
+  return emplace(value);
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::push(value_type &&value) {
+  return emplace(std::move(value));
+};
+
+template <typename value_type>
+template <typename... Args>
+bool blocking_queue<value_type>::emplace(Args &&...args) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  wait(lock, not_full_, pushers_, [this] { return has_room(); }, nullptr);
+  return emplace_locked(lock, std::forward<Args>(args)...);
+};
+
+template <typename value_type>
+template <class Rep, class Period>
+bool blocking_queue<value_type>::push_for(
+    const_reference value, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = Clock::now() + timeout;
+  std::unique_lock<std::mutex> lock{mutex_};
+  wait(lock, not_full_, pushers_, [this] { return has_room(); }, &deadline);
+  return emplace_locked(lock, value);
+};
+
+template <typename value_type>
+template <class Rep, class Period>
+bool blocking_queue<value_type>::push_for(
+    value_type &&value, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = Clock::now() + timeout;
+  std::unique_lock<std::mutex> lock{mutex_};
+  wait(lock, not_full_, pushers_, [this] { return has_room(); }, &deadline);
+  return emplace_locked(lock, std::move(value));
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::try_push(const_reference value) {
+  return try_emplace(value);
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+};
+
+template <typename value_type>
+template <typename... Args>
+bool blocking_queue<value_type>::try_emplace(Args &&...args) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  return emplace_locked(lock, std::forward<Args>(args)...);
+};
+
+/* ------------------- POP --------------------- */
+
+template <typename value_type>
+bool blocking_queue<value_type>::pop(reference value) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  wait(lock, not_empty_, poppers_, [this] { return !queue_.empty(); },
+       nullptr);
+  return pop_locked(lock, value);
+};
+
+template <typename value_type>
+template <class Rep, class Period>
+bool blocking_queue<value_type>::pop_for(
+    reference value, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = Clock::now() + timeout;
+  std::unique_lock<std::mutex> lock{mutex_};
+  wait(lock, not_empty_, poppers_, [this] { return !queue_.empty(); },
+       &deadline);
+  return pop_locked(lock, value);
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::try_pop(reference value) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  return pop_locked(lock, value);
+};
+
+/* ------------------- BATCHES --------------------- */
+
+template <typename value_type>
+template <typename InputIt>
+InputIt blocking_queue<value_type>::push_bulk(InputIt first, InputIt last) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  while (first != last) {
+    wait(lock, not_full_, pushers_, [this] { return has_room(); }, nullptr);
+    if (closed_) break;
+    size_type pushed = 0;
+    for (; first != last && has_room(); ++first, ++pushed)
+      queue_.push(*first);
+    notify(lock, not_empty_, poppers_, pushed);
+    if (first != last) lock.lock();
+  }
+  return first;
+};
+
+template <typename value_type>
+template <typename OutputIt>
+typename blocking_queue<value_type>::size_type
+blocking_queue<value_type>::drain(OutputIt out, size_type max_n) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  if (max_n)
+    wait(lock, not_empty_, poppers_, [this] { return !queue_.empty(); },
+         nullptr);
+  return drain_locked(lock, out, max_n);
+};
+
+template <typename value_type>
+template <typename OutputIt>
+typename blocking_queue<value_type>::size_type
+blocking_queue<value_type>::try_drain(OutputIt out, size_type max_n) {
+  std::unique_lock<std::mutex> lock{mutex_};
+  return drain_locked(lock, out, max_n);
+};
+
+/* ------------------- HELPERS --------------------- */
+
+template <typename value_type>
+bool blocking_queue<value_type>::has_room() const {
+  return queue_.size() < capacity_;
+};
+
+template <typename value_type>
+template <typename Pred>
+void blocking_queue<value_type>::wait(std::unique_lock<std::mutex> &lock,
+                                      std::condition_variable &cv,
+                                      size_type &waiters, Pred ready,
+                                      const Clock::time_point *deadline) {
+  auto done = [this, &ready] { return closed_ || ready(); };
+  if (done()) return;
+  ++waiters;
+  if (deadline)
+    cv.wait_until(lock, *deadline, done);
+  else
+    cv.wait(lock, done);
+  --waiters;
+};
+
+// waiters is read under the lock: a thread that goes to sleep after it
+// tests its condition under the same lock and sees the change already.
+template <typename value_type>
+void blocking_queue<value_type>::notify(std::unique_lock<std::mutex> &lock,
+                                        std::condition_variable &cv,
+                                        size_type waiters, size_type count) {
+  lock.unlock();
+  if (!waiters || !count) return;
+  if (count == 1)
+    cv.notify_one();
+  else
+    cv.notify_all();
+};
+
+template <typename value_type>
+template <typename... Args>
+bool blocking_queue<value_type>::emplace_locked(
+    std::unique_lock<std::mutex> &lock, Args &&...args) {
+  if (closed_ || !has_room()) return false;
+  queue_.emplace_back(std::forward<Args>(args)...);
+  notify(lock, not_empty_, poppers_, 1);
+  return true;
+};
+
+template <typename value_type>
+bool blocking_queue<value_type>::pop_locked(std::unique_lock<std::mutex> &lock,
+                                            reference value) {
+  if (queue_.empty()) return false;
+  value = std::move(queue_.front());
+  queue_.pop();
+  notify(lock, not_full_, pushers_, 1);
+  return true;
+};
+
+template <typename value_type>
+template <typename OutputIt>
+typename blocking_queue<value_type>::size_type
+blocking_queue<value_type>::drain_locked(std::unique_lock<std::mutex> &lock,
+                                         OutputIt out, size_type max_n) {
+  size_type drained = 0;
+  for (; drained < max_n && !queue_.empty(); ++drained) {
+    *out = std::move(queue_.front());
+    ++out;
+    queue_.pop();
+  }
+  notify(lock, not_full_, pushers_, drained);
+  return drained;
+};
+
+}  // namespace s21
@@ -0,0 +1,218 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_DEQUE_S21_DEQUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_DEQUE_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Double-ended queue over a map of fixed-size blocks, like std::deque. The
+// map is an array of block pointers; element i sits in slot start_ + i of
+// the blocks laid end to end, so indexing is a shift, a mask and two loads.
+// Pushing at either end constructs in the first or last block, and only
+// every kBlockSize pushes takes a new block. The map keeps free entries on
+// both sides of the used ones and is recentred or doubled when one side
+// runs out, so the elements themselves never move.
+//
+// A block emptied by a pop is kept as a spare for the next push that needs
+// one, so a deque used as a FIFO stops allocating once it is warm. A push
+// or pop at either end leaves references to the other elements valid;
+// iterators stay valid as long as nothing is pushed or popped.
+template <typename T>
+class deque {
+  template <bool Const>
+  class DequeIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  deque();
+  explicit deque(size_type n);
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &d);
+  deque(deque &&d) noexcept;
+  ~deque();
+
+  deque &operator=(const deque &d);
+  deque &operator=(deque &&d) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other);
+
+ private:
+  // A block holds a power of two of elements, so a slot splits into block
+  // and offset with a shift and a mask, and takes at most 512 bytes like
+  // libstdc++'s: with 1 KiB blocks a burst of strings, which allocate on
+  // their own as well, ran at half the speed. Large elements get 16 to a
+  // block.
+  static constexpr size_type kBlockShift = [] {
+    size_type shift = 4;
+    while ((size_type{2} << shift) * sizeof(T) <= 512) ++shift;
+    return shift;
+  }();
+  static constexpr size_type kBlockSize = size_type{1} << kBlockShift;
+  static constexpr size_type kBlockMask = kBlockSize - 1;
+  static constexpr size_type kMinMapSize = 8;
+
+  value_type *slot(size_type index) const;
+  // The slot past the back or before the front, growing the map and
+  // allocating the block as needed.
+  value_type *claim_back();
+  value_type *claim_front();
+  // The slot, allocating its block if the map entry is empty.
+  value_type *claim(size_type index);
+  value_type *acquire();
+  void recycle(value_type *&block);
+  static void release(value_type *block);
+  // Centres the used map entries with room for count more blocks on either
+  // side, doubling the map if it is more than half full.
+  void reserve_map(size_type count);
+  void append(const deque &d);
+
+  // Map entries are either null or a block the deque owns. The blocks of
+  // the elements are always present, others may be left over from pops.
+  value_type **map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+  value_type *spare_;
+
+  template <bool Const>
+  class DequeIterator {
+    friend class deque<T>;
+    friend class DequeIterator<!Const>;
+    using owner_type = std::conditional_t<Const, const deque, deque>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    DequeIterator() : owner_(nullptr), index_(0) {}
+    DequeIterator(owner_type *owner, size_type index)
+        : owner_(owner), index_(index) {}
+    // iterator converts to const_iterator, not the other way round
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    DequeIterator(const DequeIterator<OtherConst> &other)
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    pointer operator->() const { return &(*owner_)[index_]; }
+    reference operator[](difference_type n) const {
+      return (*owner_)[index_ + n];
+    }
+
+    DequeIterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator tmp = *this;
+      ++index_;
+      return tmp;
+    }
+    DequeIterator &operator--() {
+      --index_;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator tmp = *this;
+      --index_;
+      return tmp;
+    }
+    DequeIterator &operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const {
+      return {owner_, index_ + n};
+    }
+    friend DequeIterator operator+(difference_type n, DequeIterator it) {
+      return it + n;
+    }
+    DequeIterator operator-(difference_type n) const {
+      return {owner_, index_ - n};
+    }
+    difference_type operator-(const DequeIterator &other) const {
+      return static_cast<difference_type>(index_ - other.index_);
+    }
+
+    friend bool operator==(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ == b.index_;
+    }
+    friend bool operator!=(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ != b.index_;
+    }
+    friend bool operator<(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ < b.index_;
+    }
+    friend bool operator>(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ > b.index_;
+    }
+    friend bool operator<=(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ <= b.index_;
+    }
+    friend bool operator>=(const DequeIterator &a, const DequeIterator &b) {
+      return a.index_ >= b.index_;
+    }
+
+   private:
+    owner_type *owner_;
+    size_type index_;
+  };
+};
+};  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_DEQUE_S21_DEQUE_H_
@@ -0,0 +1,340 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ----------------- */
+
+template <typename T>
+deque<T>::deque()
+    : map_(nullptr), map_size_(0), start_(0), size_(0), spare_(nullptr) {}
+
+template <typename T>
+deque<T>::deque(size_type n) : deque() {
+  for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<value_type> const &items) : deque() {
+  for (const auto &item : items) push_back(item);
+}
+
+template <typename T>
+deque<T>::deque(const deque &d) : deque() {
+  append(d);
+}
+
+template <typename T>
+deque<T>::deque(deque &&d) noexcept : deque() {
+  swap(d);
+}
+
+template <typename T>
+deque<T>::~deque() {
+  clear();
+  release(spare_);
+  delete[] map_;
+}
+
+/* ------------------------ OPERATORS ---------------------------- */
+
+template <typename T>
+deque<T> &deque<T>::operator=(const deque &d) {
+  if (this == &d) return *this;
+
+  clear();
+  append(d);
+
+  return *this;
+}
+
+template <typename T>
+deque<T> &deque<T>::operator=(deque &&d) noexcept {
+  if (this == &d) return *this;
+
+  clear();
+  swap(d);
+
+  return *this;
+}
+
+/* ------------------------ ELEMENT ACCESS ----------------------- */
+
+template <typename T>
+typename deque<T>::reference deque<T>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index is out of range");
+  return *slot(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index is out of range");
+  return *slot(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::operator[](size_type pos) {
+  return *slot(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::operator[](size_type pos) const {
+  return *slot(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::front() {
+  return *slot(start_);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::front() const {
+  return *slot(start_);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::back() {
+  return *slot(start_ + size_ - 1);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::back() const {
+  return *slot(start_ + size_ - 1);
+}
+
+/* ------------------------- ITERATORS --------------------------- */
+
+template <typename T>
+typename deque<T>::iterator deque<T>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::cbegin() const {
+  return begin();
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::cend() const {
+  return end();
+}
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename T>
+bool deque<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename deque<T>::size_type deque<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+typename deque<T>::size_type deque<T>::max_size() const {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type);
+}
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+// The map and the blocks are kept, only a spare survives of the blocks.
+template <typename T>
+void deque<T>::clear() {
+  if constexpr (!std::is_trivially_destructible_v<value_type>)
+    for (size_type i = 0; i < size_; ++i) std::destroy_at(slot(start_ + i));
+  size_ = 0;
+  for (size_type i = 0; i < map_size_; ++i)
+    if (map_[i]) recycle(map_[i]);
+  start_ = (map_size_ / 2) << kBlockShift;
+}
+
+template <typename T>
+void deque<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void deque<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+void deque<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+void deque<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// Start and size only move once the element is constructed, so a throwing
+// constructor leaves the deque as it was, at most with one more block.
+// Inside a block the slot next to an element is known to be there, the map
+// is only looked at when a block boundary is crossed. The pushes and pops
+// are marked inline: left to itself GCC called them out of line, which cost
+// half the throughput of a queue.
+template <typename T>
+template <typename... Args>
+inline typename deque<T>::reference deque<T>::emplace_back(Args &&...args) {
+  size_type index = start_ + size_;
+  value_type *where =
+      size_ && (index & kBlockMask) ? slot(index) : claim_back();
+  ::new (static_cast<void *>(where)) value_type(std::forward<Args>(args)...);
+  ++size_;
+  return *where;
+}
+
+template <typename T>
+template <typename... Args>
+inline typename deque<T>::reference deque<T>::emplace_front(Args &&...args) {
+  value_type *where = size_ && (start_ & kBlockMask) ? slot(start_ - 1)
+                                                     : claim_front();
+  ::new (static_cast<void *>(where)) value_type(std::forward<Args>(args)...);
+  --start_;
+  ++size_;
+  return *where;
+}
+
+// A block is given up once its last element is popped, except the one an
+// empty deque ends up in, so pushing and popping a single element does not
+// take and return a block every time.
+template <typename T>
+inline void deque<T>::pop_back() {
+  if (!size_) return;
+  size_type index = start_ + --size_;
+  std::destroy_at(slot(index));
+  if (!(index & kBlockMask) && size_) recycle(map_[index >> kBlockShift]);
+}
+
+template <typename T>
+inline void deque<T>::pop_front() {
+  if (!size_) return;
+  std::destroy_at(slot(start_));
+  ++start_;
+  --size_;
+  if (!(start_ & kBlockMask)) recycle(map_[(start_ - 1) >> kBlockShift]);
+}
+
+template <typename T>
+void deque<T>::swap(deque &other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+/* -------------------------- BLOCKS ----------------------------- */
+
+template <typename T>
+inline typename deque<T>::value_type *deque<T>::slot(size_type index) const {
+  return map_[index >> kBlockShift] + (index & kBlockMask);
+}
+
+template <typename T>
+typename deque<T>::value_type *deque<T>::claim_back() {
+  if (start_ + size_ >= map_size_ << kBlockShift) reserve_map(1);
+  return claim(start_ + size_);
+}
+
+template <typename T>
+typename deque<T>::value_type *deque<T>::claim_front() {
+  if (!start_) reserve_map(1);
+  return claim(start_ - 1);
+}
+
+template <typename T>
+typename deque<T>::value_type *deque<T>::claim(size_type index) {
+  value_type *&block = map_[index >> kBlockShift];
+  if (!block) block = acquire();
+  return block + (index & kBlockMask);
+}
+
+template <typename T>
+typename deque<T>::value_type *deque<T>::acquire() {
+  if (value_type *block = spare_) {
+    spare_ = nullptr;
+    return block;
+  }
+  if constexpr (alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return static_cast<value_type *>(
+        ::operator new(kBlockSize * sizeof(value_type),
+                       std::align_val_t{alignof(value_type)}));
+  } else {
+    return static_cast<value_type *>(
+        ::operator new(kBlockSize * sizeof(value_type)));
+  }
+}
+
+// Only the most recently freed block is kept, it is the one still in cache.
+template <typename T>
+void deque<T>::recycle(value_type *&block) {
+  release(spare_);
+  spare_ = block;
+  block = nullptr;
+}
+
+template <typename T>
+void deque<T>::release(value_type *block) {
+  if (!block) return;
+  if constexpr (alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(block, std::align_val_t{alignof(value_type)});
+  } else {
+    ::operator delete(block);
+  }
+}
+
+// The used entries are those of the blocks holding elements, or the block
+// start_ is in when there are none; the others are released first, so
+// every entry outside the moved range ends up null. An empty deque may have
+// start_ just past the end of the map, its block is then not there yet.
+template <typename T>
+void deque<T>::reserve_map(size_type count) {
+  size_type first = start_ >> kBlockShift;
+  size_type used =
+      size_ ? ((start_ + size_ - 1) >> kBlockShift) - first + 1 : 1;
+  size_type new_size = map_size_ ? map_size_ : kMinMapSize;
+  while (new_size < 2 * (used + count)) new_size *= 2;
+  size_type new_first = (new_size - used) / 2;
+
+  value_type **map =
+      new_size == map_size_ ? map_ : new value_type *[new_size]();
+  for (size_type i = 0; i < map_size_; ++i)
+    if (map_[i] && (i < first || i >= first + used)) recycle(map_[i]);
+  size_type present =
+      first < map_size_ ? std::min(used, map_size_ - first) : 0;
+  if (map != map_ || new_first < first)
+    std::copy(map_ + first, map_ + first + present, map + new_first);
+  else if (new_first > first)
+    std::copy_backward(map_ + first, map_ + first + present,
+                       map + new_first + present);
+  std::fill(map, map + new_first, nullptr);
+  std::fill(map + new_first + present, map + new_size, nullptr);
+  if (map != map_) {
+    delete[] map_;
+    map_ = map;
+    map_size_ = new_size;
+  }
+  start_ = (new_first << kBlockShift) + (start_ & kBlockMask);
+}
+
+template <typename T>
+void deque<T>::append(const deque &d) {
+  for (size_type i = 0; i < d.size_; ++i) push_back(d[i]);
+}
+
+}  // namespace s21
@@ -0,0 +1,111 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_MPMC_QUEUE_S21_MPMC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_MPMC_QUEUE_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Bounded FIFO for any number of producer and consumer threads, after
+// Dmitry Vyukov's bounded MPMC queue. Every slot of the power of two ring
+// carries a sequence number telling whose turn it is: a producer may fill
+// the slot at position pos once its sequence is pos, a consumer may empty it
+// once it is pos + 1, and emptying it sets it to pos + capacity for the
+// producer of the next lap. Claiming a position is one compare-and-swap on
+// the shared tail or head, the element itself is then written or read
+// without contention.
+//
+// try_push and try_pop never block. push and pop retry for a while and then
+// park on a condition variable until a slot frees up or an element arrives.
+// Elements have to be nothrow movable: a claimed slot can not be given back.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue elements have to be nothrow movable");
+
+  // capacity is rounded up to a power of two, and to at least 2, one with
+  // no power of two to round up to throws std::length_error
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue &q) = delete;
+  mpmc_queue(mpmc_queue &&q) = delete;
+  ~mpmc_queue();
+
+  mpmc_queue &operator=(const mpmc_queue &q) = delete;
+  mpmc_queue &operator=(mpmc_queue &&q) = delete;
+
+  // Exact only while no thread is pushing or popping, otherwise a snapshot.
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(reference value);
+
+  void push(const_reference value);
+  void push(value_type &&value);
+  void pop(reference value);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  // tries before a blocking call parks, the later ones yield in between
+  static constexpr int kSpinTries = 64;
+  static constexpr int kYieldAfter = 16;
+
+  struct Slot {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct alignas(kCacheLine) Cursor {
+    std::atomic<size_type> position{0};
+  };
+
+  // Threads parked in push wait on not_full, the ones in pop on not_empty.
+  // The waiter counts let the other side skip the mutex when nobody sleeps.
+  struct alignas(kCacheLine) Parking {
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    std::atomic<int> pushers{0};
+    std::atomic<int> poppers{0};
+  };
+
+  static value_type *item(Slot &slot);
+  template <typename Fn>
+  static bool spin(Fn try_once);
+  template <class... Args>
+  bool emplace_once(Args &&...args);
+  bool pop_once(reference value);
+  void wake(std::atomic<int> &waiters, std::condition_variable &cv);
+
+  size_type mask_;
+  Slot *slots_;
+  Cursor tail_;
+  Cursor head_;
+  Parking parking_;
+};
+};  // namespace s21
+
+#include "s21_mpmc_queue.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_MPMC_QUEUE_S21_MPMC_QUEUE_H_
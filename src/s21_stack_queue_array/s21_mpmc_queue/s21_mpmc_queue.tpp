@@ -0,0 +1,186 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename value_type>
+mpmc_queue<value_type>::mpmc_queue(size_type capacity) : mask_{1} {
+  if (capacity > (std::numeric_limits<size_type>::max() >> 1) + 1) {
+    throw std::length_error(
+        "Can't create s21::mpmc_queue larger than the largest power of two");
+  }
+  while (mask_ + 1 < capacity) mask_ = mask_ * 2 + 1;
+  slots_ = new Slot[mask_ + 1];
+  for (size_type i = 0; i <= mask_; ++i)
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+};
+
+template <typename value_type>
+mpmc_queue<value_type>::~mpmc_queue() {
+  size_type tail = tail_.position.load(std::memory_order_relaxed);
+  for (size_type head = head_.position.load(std::memory_order_relaxed);
+       head != tail; ++head)
+    std::destroy_at(item(slots_[head & mask_]));
+  delete[] slots_;
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename value_type>
+bool mpmc_queue<value_type>::empty() const {
+  return !size();
+};
+
+// head is read first: it never passes the tail read after it
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::size()
+    const {
+  size_type head = head_.position.load(std::memory_order_acquire);
+  return tail_.position.load(std::memory_order_acquire) - head;
+};
+
+template <typename value_type>
+typename mpmc_queue<value_type>::size_type mpmc_queue<value_type>::capacity()
+    const {
+  return mask_ + 1;
+};
+
+/* ------------------- NON-BLOCKING --------------------- */
+
+template <typename value_type>
+bool mpmc_queue<value_type>::try_push(const_reference value) {
+  return try_emplace(value);
+};
+
+template <typename value_type>
+bool mpmc_queue<value_type>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+};
+
+template <typename value_type>
+template <typename... Args>
+bool mpmc_queue<value_type>::try_emplace(Args &&...args) {
+  if (!emplace_once(std::forward<Args>(args)...)) return false;
+  wake(parking_.poppers, parking_.not_empty);
+  return true;
+};
+
+template <typename value_type>
+bool mpmc_queue<value_type>::try_pop(reference value) {
+  if (!pop_once(value)) return false;
+  wake(parking_.pushers, parking_.not_full);
+  return true;
+};
+
+/* ------------------- BLOCKING --------------------- */
+
+template <typename value_type>
+void mpmc_queue<value_type>::push(const_reference value) {
+  push(value_type(value));
+};
+
+// A failed attempt leaves value alone, so it is retried until one succeeds.
+template <typename value_type>
+void mpmc_queue<value_type>::push(value_type &&value) {
+  auto attempt = [this, &value] { return emplace_once(std::move(value)); };
+  if (!spin(attempt)) {
+    std::unique_lock<std::mutex> lock{parking_.mutex};
+    parking_.pushers.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    parking_.not_full.wait(lock, attempt);
+    parking_.pushers.fetch_sub(1);
+  }
+  wake(parking_.poppers, parking_.not_empty);
+};
+
+template <typename value_type>
+void mpmc_queue<value_type>::pop(reference value) {
+  auto attempt = [this, &value] { return pop_once(value); };
+  if (!spin(attempt)) {
+    std::unique_lock<std::mutex> lock{parking_.mutex};
+    parking_.poppers.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    parking_.not_empty.wait(lock, attempt);
+    parking_.poppers.fetch_sub(1);
+  }
+  wake(parking_.pushers, parking_.not_full);
+};
+
+/* ------------------- HELPERS --------------------- */
+
+template <typename value_type>
+value_type *mpmc_queue<value_type>::item(Slot &slot) {
+  return std::launder(reinterpret_cast<value_type *>(slot.storage));
+};
+
+template <typename value_type>
+template <typename Fn>
+bool mpmc_queue<value_type>::spin(Fn try_once) {
+  for (int i = 0; i < kSpinTries; ++i) {
+    if (try_once()) return true;
+    if (i >= kYieldAfter) std::this_thread::yield();
+  }
+  return false;
+};
+
+// A constructor that may throw runs before a slot is claimed, only the
+// nothrow move into the slot happens after.
+template <typename value_type>
+template <typename... Args>
+bool mpmc_queue<value_type>::emplace_once(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible_v<value_type, Args &&...>) {
+    value_type value(std::forward<Args>(args)...);
+    return emplace_once(std::move(value));
+  } else {
+    size_type pos = tail_.position.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+      slot = &slots_[pos & mask_];
+      size_type sequence = slot->sequence.load(std::memory_order_acquire);
+      auto lag = static_cast<std::intptr_t>(sequence - pos);
+      if (lag < 0) return false;
+      if (!lag && tail_.position.compare_exchange_weak(
+                      pos, pos + 1, std::memory_order_relaxed))
+        break;
+      if (lag) pos = tail_.position.load(std::memory_order_relaxed);
+    }
+    ::new (static_cast<void *>(slot->storage))
+        value_type(std::forward<Args>(args)...);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+template <typename value_type>
+bool mpmc_queue<value_type>::pop_once(reference value) {
+  size_type pos = head_.position.load(std::memory_order_relaxed);
+  Slot *slot;
+  for (;;) {
+    slot = &slots_[pos & mask_];
+    size_type sequence = slot->sequence.load(std::memory_order_acquire);
+    auto lag = static_cast<std::intptr_t>(sequence - (pos + 1));
+    if (lag < 0) return false;
+    if (!lag && head_.position.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed))
+      break;
+    if (lag) pos = head_.position.load(std::memory_order_relaxed);
+  }
+  value = std::move(*item(*slot));
+  std::destroy_at(item(*slot));
+  slot->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+};
+
+// The fence orders the slot just published before the waiter count, and
+// pairs with the one a waiter issues after counting itself in: either the
+// waiter sees the slot, or this side sees the waiter and wakes it under
+// the mutex it holds while testing.
+template <typename value_type>
+void mpmc_queue<value_type>::wake(std::atomic<int> &waiters,
+                                  std::condition_variable &cv) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!waiters.load(std::memory_order_relaxed)) return;
+  std::lock_guard<std::mutex> lock{parking_.mutex};
+  cv.notify_one();
+};
+
+}  // namespace s21
@@ -0,0 +1,83 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_PRIORITY_QUEUE_S21_PRIORITY_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_PRIORITY_QUEUE_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "../../s21_vector/vector/s21_vector.h"
+#include "../s21_stack/s21_stack.h"
+
+namespace s21 {
+// A max-heap adaptor over a random access container, like
+// std::priority_queue: top() is the element no other compares less than.
+// The heap is d-ary, node i has the children Arity * i + 1 up to
+// Arity * i + Arity. A wider node makes the tree shallower, so pop takes
+// fewer levels, and its children are adjacent in memory, so comparing them
+// costs one or two cache lines instead of one per child. 4 is a good
+// default, 2 gives the classic binary heap.
+//
+// The container has to provide operator[], front, size, empty,
+// push_back, emplace_back, pop_back, clear and swap; reserve is forwarded
+// when it has one.
+template <typename T, typename Container = Vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+  static constexpr size_type arity = Arity;
+
+  priority_queue();
+  explicit priority_queue(const Compare &compare);
+  priority_queue(std::initializer_list<value_type> const &items);
+  // The constructors from a range or a container build the heap in O(n)
+  // instead of pushing the elements one at a time.
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const Compare &compare = Compare());
+  explicit priority_queue(Container &&c, const Compare &compare = Compare());
+  priority_queue(const priority_queue &q) = default;
+  priority_queue(priority_queue &&q) = default;
+  ~priority_queue() = default;
+
+  priority_queue &operator=(const priority_queue &q) = default;
+  priority_queue &operator=(priority_queue &&q) = default;
+
+  const_reference top() const;
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+  void push(const_reference value);
+  void push(value_type &&value);
+  template <class... Args>
+  void emplace(Args &&...args);
+  void pop();
+  // Appends [first, last) and restores the heap, with one O(n) rebuild
+  // when the batch is at least as large as the heap it joins.
+  template <typename InputIt>
+  void push_bulk(InputIt first, InputIt last);
+  void swap(priority_queue &other);
+  void clear();
+
+ private:
+  void sift_up(size_type hole);
+  void sift_down(size_type hole);
+  void heapify();
+
+  Container c_;
+  Compare compare_;
+};
+};  // namespace s21
+
+#include "s21_priority_queue.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_PRIORITY_QUEUE_S21_PRIORITY_QUEUE_H_
@@ -0,0 +1,163 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ----------------- */
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue()
+    : c_(), compare_() {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare)
+    : c_(), compare_(compare) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items)
+    : c_(), compare_() {
+  reserve(items.size());
+  for (const auto &item : items) c_.push_back(item);
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename InputIt>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    InputIt first, InputIt last, const Compare &compare)
+    : c_(), compare_(compare) {
+  for (; first != last; ++first) c_.push_back(*first);
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    Container &&c, const Compare &compare)
+    : c_(std::move(c)), compare_(compare) {
+  heapify();
+}
+
+/* ------------------------- TOP --------------------------------- */
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::const_reference
+priority_queue<T, Container, Compare, Arity>::top() const {
+  return c_.front();
+}
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+bool priority_queue<T, Container, Compare, Arity>::empty() const {
+  return c_.empty();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::size_type
+priority_queue<T, Container, Compare, Arity>::size() const {
+  return c_.size();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::reserve(size_type size) {
+  if constexpr (has_reserve<Container>::value) c_.reserve(size);
+}
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(
+    const_reference value) {
+  c_.push_back(value);
+  sift_up(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type &&value) {
+  c_.push_back(std::move(value));
+  sift_up(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
+  c_.emplace_back(std::forward<Args>(args)...);
+  sift_up(c_.size() - 1);
+}
+
+// The last leaf takes the place of the root and sinks back down.
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+  if (c_.empty()) return;
+  if (c_.size() > 1) c_[0] = std::move(c_[c_.size() - 1]);
+  c_.pop_back();
+  if (!c_.empty()) sift_down(0);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename InputIt>
+void priority_queue<T, Container, Compare, Arity>::push_bulk(InputIt first,
+                                                             InputIt last) {
+  size_type heap_size = c_.size();
+  for (; first != last; ++first) c_.push_back(*first);
+  if (c_.size() - heap_size >= heap_size) {
+    heapify();
+  } else {
+    for (size_type i = heap_size; i < c_.size(); ++i) sift_up(i);
+  }
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(
+    priority_queue &other) {
+  c_.swap(other.c_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::clear() {
+  c_.clear();
+}
+
+/* ------------------------- HEAP -------------------------------- */
+
+// Both sifts carry the moving element in a local and shift the others into
+// the hole it leaves, one move per level instead of a swap.
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_up(size_type hole) {
+  value_type value = std::move(c_[hole]);
+  while (hole > 0) {
+    size_type parent = (hole - 1) / Arity;
+    if (!compare_(c_[parent], value)) break;
+    c_[hole] = std::move(c_[parent]);
+    hole = parent;
+  }
+  c_[hole] = std::move(value);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_down(size_type hole) {
+  size_type size = c_.size();
+  value_type value = std::move(c_[hole]);
+  for (;;) {
+    size_type first = hole * Arity + 1;
+    if (first >= size) break;
+    size_type last = size - first > Arity ? first + Arity : size;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child)
+      if (compare_(c_[best], c_[child])) best = child;
+    if (!compare_(value, c_[best])) break;
+    c_[hole] = std::move(c_[best]);
+    hole = best;
+  }
+  c_[hole] = std::move(value);
+}
+
+// Floyd's construction: sinking every inner node, the deepest first, costs
+// O(n) in total, as most nodes sit near the leaves and sink only a little.
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::heapify() {
+  if (c_.size() < 2) return;
+  for (size_type i = (c_.size() - 2) / Arity + 1; i-- > 0;) sift_down(i);
+}
+
+}  // namespace s21
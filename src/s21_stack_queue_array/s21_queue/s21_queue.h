@@ -1,10 +1,23 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_QUEUE_S21_QUEUE_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_QUEUE_S21_QUEUE_H_
 
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
+
 namespace s21 {
-template <typename T>
+// A FIFO adaptor over a sequence container, like std::queue. Elements are
+// pushed at the back and popped at the front of the container, which has to
+// provide front, back, push_back, emplace_back, pop_front, size, empty,
+// clear and swap. The default s21::deque keeps the elements in fixed-size
+// blocks and reuses the block it frees last, so a queue that is drained as
+// fast as it is filled stops allocating altogether.
+template <typename T, typename Container = deque<T>>
 class Queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -12,20 +25,23 @@ class Queue {
 
   Queue();
   Queue(std::initializer_list<value_type> const& items);
+  explicit Queue(const Container& c);
+  explicit Queue(Container&& c);
   Queue(const Queue& q);
   Queue(Queue&& q) noexcept;
   ~Queue();
 
-  Queue<T>& operator=(const Queue& q);
-  Queue<T>& operator=(Queue&& q) noexcept;
+  Queue& operator=(const Queue& q);
+  Queue& operator=(Queue&& q) noexcept;
 
   reference front();
   const_reference front() const;
   reference back();
   const_reference back() const;
-  bool empty();
-  size_type size();
+  bool empty() const;
+  size_type size() const;
   void push(const_reference value);
+  void push(value_type&& value);
   void pop();
   void swap(Queue& other);
   void clear();
@@ -34,15 +50,8 @@ class Queue {
   void emplace_back(Args&&... args);
 
  private:
-  struct Node {
-    value_type value;
-    Node* next;
-  };
-
-  Node* first_;
-  Node* last_;
-  size_type size_;
+  Container c_;
 };
 };  // namespace s21
 #include "s21_queue.tpp"
-#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_QUEUE_S21_QUEUE_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_QUEUE_S21_QUEUE_H_
@@ -0,0 +1,89 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_SPSC_QUEUE_S21_SPSC_QUEUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_SPSC_QUEUE_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Bounded FIFO for exactly one producer thread and one consumer thread,
+// without locks. The slots form a ring of a power of two size; tail counts
+// the pushes and is only written by the producer, head counts the pops and
+// is only written by the consumer, and each publishes its index with a
+// release store that the other side reads with acquire. The indices sit on
+// separate cache lines, and each side keeps a cached copy of the other's
+// index, so the shared lines only move when the queue looks full or empty.
+//
+// try_push, try_emplace and push_n may only be called from the producer,
+// try_pop and pop_n only from the consumer.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // capacity is rounded up to a power of two, and to at least 2, one with
+  // no power of two to round up to throws std::length_error
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue &q) = delete;
+  spsc_queue(spsc_queue &&q) = delete;
+  ~spsc_queue();
+
+  spsc_queue &operator=(const spsc_queue &q) = delete;
+  spsc_queue &operator=(spsc_queue &&q) = delete;
+
+  // Exact only while neither side is running, otherwise a snapshot.
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+  template <class... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(reference value);
+
+  // Pushes up to n elements of [first, first + n), as many as there is room
+  // for, and publishes them with a single store. Returns how many.
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type n);
+  // Moves up to max_n elements to out in FIFO order. Returns how many.
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type max_n);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr std::align_val_t kSlotsAlignment{
+      alignof(T) > kCacheLine ? alignof(T) : kCacheLine};
+
+  struct alignas(kCacheLine) Producer {
+    std::atomic<size_type> tail{0};
+    size_type head_cache{0};
+  };
+
+  struct alignas(kCacheLine) Consumer {
+    std::atomic<size_type> head{0};
+    size_type tail_cache{0};
+  };
+
+  value_type *slot(size_type index) const;
+  size_type free_slots(size_type tail, size_type wanted);
+  size_type ready_slots(size_type head, size_type wanted);
+
+  size_type mask_;
+  value_type *slots_;
+  Producer producer_;
+  Consumer consumer_;
+};
+};  // namespace s21
+
+#include "s21_spsc_queue.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_SPSC_QUEUE_S21_SPSC_QUEUE_H_
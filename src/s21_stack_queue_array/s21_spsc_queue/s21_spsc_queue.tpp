@@ -0,0 +1,155 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename value_type>
+spsc_queue<value_type>::spsc_queue(size_type capacity) : mask_{1} {
+  if (capacity > (std::numeric_limits<size_type>::max() >> 1) + 1) {
+    throw std::length_error(
+        "Can't create s21::spsc_queue larger than the largest power of two");
+  }
+  while (mask_ + 1 < capacity) mask_ = mask_ * 2 + 1;
+  slots_ = static_cast<value_type *>(
+      ::operator new((mask_ + 1) * sizeof(value_type), kSlotsAlignment));
+};
+
+template <typename value_type>
+spsc_queue<value_type>::~spsc_queue() {
+  size_type tail = producer_.tail.load(std::memory_order_relaxed);
+  for (size_type head = consumer_.head.load(std::memory_order_relaxed);
+       head != tail; ++head)
+    std::destroy_at(slot(head));
+  ::operator delete(slots_, kSlotsAlignment);
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename value_type>
+bool spsc_queue<value_type>::empty() const {
+  return !size();
+};
+
+// head is read first: it never passes the tail read after it
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::size()
+    const {
+  size_type head = consumer_.head.load(std::memory_order_acquire);
+  return producer_.tail.load(std::memory_order_acquire) - head;
+};
+
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::capacity()
+    const {
+  return mask_ + 1;
+};
+
+/* ------------------- PRODUCER --------------------- */
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_push(const_reference value) {
+  return try_emplace(value);
+};
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+};
+
+template <typename value_type>
+template <typename... Args>
+bool spsc_queue<value_type>::try_emplace(Args &&...args) {
+  size_type tail = producer_.tail.load(std::memory_order_relaxed);
+  if (!free_slots(tail, 1)) return false;
+  ::new (static_cast<void *>(slot(tail)))
+      value_type(std::forward<Args>(args)...);
+  producer_.tail.store(tail + 1, std::memory_order_release);
+  return true;
+};
+
+// The elements constructed before a throwing one are still published.
+template <typename value_type>
+template <typename InputIt>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::push_n(
+    InputIt first, size_type n) {
+  size_type tail = producer_.tail.load(std::memory_order_relaxed);
+  n = free_slots(tail, n);
+  size_type i = 0;
+  try {
+    for (; i < n; ++i, ++first)
+      ::new (static_cast<void *>(slot(tail + i))) value_type(*first);
+  } catch (...) {
+    producer_.tail.store(tail + i, std::memory_order_release);
+    throw;
+  }
+  producer_.tail.store(tail + n, std::memory_order_release);
+  return n;
+};
+
+// How many of the wanted slots from tail on are free, the consumer's head
+// is only loaded again when the cached one does not leave enough room.
+template <typename value_type>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::free_slots(
+    size_type tail, size_type wanted) {
+  size_type free = capacity() - (tail - producer_.head_cache);
+  if (free < wanted) {
+    producer_.head_cache = consumer_.head.load(std::memory_order_acquire);
+    free = capacity() - (tail - producer_.head_cache);
+  }
+  return free < wanted ? free : wanted;
+};
+
+/* ------------------- CONSUMER --------------------- */
+
+template <typename value_type>
+bool spsc_queue<value_type>::try_pop(reference value) {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  if (!ready_slots(head, 1)) return false;
+  value_type *item = slot(head);
+  value = std::move(*item);
+  std::destroy_at(item);
+  consumer_.head.store(head + 1, std::memory_order_release);
+  return true;
+};
+
+// The elements handed out before a throwing assignment stay popped, the one
+// it threw on is left at the front.
+template <typename value_type>
+template <typename OutputIt>
+typename spsc_queue<value_type>::size_type spsc_queue<value_type>::pop_n(
+    OutputIt out, size_type max_n) {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  size_type n = ready_slots(head, max_n);
+  size_type i = 0;
+  try {
+    for (; i < n; ++i, ++out) {
+      value_type *item = slot(head + i);
+      *out = std::move(*item);
+      std::destroy_at(item);
+    }
+  } catch (...) {
+    consumer_.head.store(head + i, std::memory_order_release);
+    throw;
+  }
+  consumer_.head.store(head + n, std::memory_order_release);
+  return n;
+};
+
+template <typename value_type>
+typename spsc_queue<value_type>::size_type
+spsc_queue<value_type>::ready_slots(size_type head, size_type wanted) {
+  size_type ready = consumer_.tail_cache - head;
+  if (ready < wanted) {
+    consumer_.tail_cache = producer_.tail.load(std::memory_order_acquire);
+    ready = consumer_.tail_cache - head;
+  }
+  return ready < wanted ? ready : wanted;
+};
+
+/* ------------------- HELPERS --------------------- */
+
+template <typename value_type>
+value_type *spsc_queue<value_type>::slot(size_type index) const {
+  return slots_ + (index & mask_);
+};
+
+}  // namespace s21
@@ -1,10 +1,31 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_STACK_S21_STACK_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_STACK_S21_STACK_H_
 
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_vector/vector/s21_vector.h"
+
 namespace s21 {
-template <typename T>
+// Whether Container has a reserve(size_type) member.
+template <typename Container, typename = void>
+struct has_reserve : std::false_type {};
+
+template <typename Container>
+struct has_reserve<
+    Container, std::void_t<decltype(std::declval<Container&>().reserve(0))>>
+    : std::true_type {};
+
+// A LIFO adaptor over a sequence container, like std::stack. The top is the
+// back of the container, which has to provide back, push_back, emplace_back,
+// pop_back, size, empty, clear and swap; reserve is forwarded when the
+// container has one. The default keeps the elements contiguous in an
+// s21::Vector, so a push only allocates when the vector grows.
+template <typename T, typename Container = Vector<T>>
 class Stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -12,34 +33,34 @@ class Stack {
 
   Stack();
   Stack(std::initializer_list<value_type> const& items);
+  explicit Stack(const Container& c);
+  explicit Stack(Container&& c);
   Stack(const Stack& s);
   Stack(Stack&& s) noexcept;
   ~Stack();
 
-  Stack<T>& operator=(const Stack& s);
-  Stack<T>& operator=(Stack&& s) noexcept;
+  Stack& operator=(const Stack& s);
+  Stack& operator=(Stack&& s) noexcept;
 
   const_reference top() const;
   reference top();
   bool empty();
   size_type size();
+  void reserve(size_type size);
   void push(const_reference value);
+  void push(value_type&& value);
   void pop();
   void swap(Stack& other);
   void clear();
 
+  template <class... Args>
+  reference emplace(Args&&... args);
   template <class... Args>
   void emplace_front(Args&&... args);
 
  private:
-  struct Node {
-    value_type value;
-    Node* next;
-  };
-
-  Node* head_;
-  size_type size_;
+  Container c_;
 };
 };  // namespace s21
 #include "s21_stack.tpp"
-#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_STACK_S21_STACK_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_STACK_S21_STACK_H_
@@ -2,147 +2,122 @@ namespace s21 {
 
 /* ------------------ CONSTRUSCTORS / DESTRUCTOR ----------------- */
 
-template <typename T>
-Stack<T>::Stack() : head_(nullptr), size_(0) {}
+template <typename T, typename Container>
+Stack<T, Container>::Stack() : c_() {}
 
-template <typename T>
-Stack<T>::Stack(std::initializer_list<value_type> const &items)
-    : head_(nullptr), size_(0) {
+template <typename T, typename Container>
+Stack<T, Container>::Stack(std::initializer_list<value_type> const &items)
+    : c_() {
+  reserve(items.size());
   for (auto it = items.begin(); it < items.end(); it++) {
     push(*it);
   }
 }
 
-template <typename T>
-Stack<T>::Stack(const Stack &s) : head_(nullptr), size_(0) {
-  Node **this_p = &head_;
-  Node *other_p = s.head_;
-
-  while (other_p) {
-    *this_p = new Node();
-    (*this_p)->value = other_p->value;
-    this_p = &((*this_p)->next);
-    other_p = other_p->next;
-    size_ += 1;
-  }
-}
+template <typename T, typename Container>
+Stack<T, Container>::Stack(const Container &c) : c_(c) {}
 
-template <typename T>
-Stack<T>::Stack(Stack &&s) noexcept : head_(s.head_), size_(s.size_) {
-  s.head_ = nullptr;
-  s.size_ = 0;
-}
+template <typename T, typename Container>
+Stack<T, Container>::Stack(Container &&c) : c_(std::move(c)) {}
 
-template <typename T>
-Stack<T>::~Stack() {
-  clear();
-}
+template <typename T, typename Container>
+Stack<T, Container>::Stack(const Stack &s) : c_(s.c_) {}
+
+template <typename T, typename Container>
+Stack<T, Container>::Stack(Stack &&s) noexcept : c_(std::move(s.c_)) {}
+
+template <typename T, typename Container>
+Stack<T, Container>::~Stack() {}
 
 /* ------------------------ OPERATORS ---------------------------- */
 
-template <typename T>
-Stack<T> &Stack<T>::operator=(Stack &&s) noexcept {
+template <typename T, typename Container>
+Stack<T, Container> &Stack<T, Container>::operator=(Stack &&s) noexcept {
   if (this == &s) return *this;
 
-  clear();
-  head_ = s.head_;
-  size_ = s.size_;
-
-  s.head_ = nullptr;
-  s.size_ = 0;
+  c_ = std::move(s.c_);
 
   return *this;
 }
 
-template <typename T>
-Stack<T> &Stack<T>::operator=(const Stack &s) {
+template <typename T, typename Container>
+Stack<T, Container> &Stack<T, Container>::operator=(const Stack &s) {
   if (this == &s) return *this;
 
-  clear();
-
-  Node **this_p = &head_;
-  Node *other_p = s.head_;
-
-  while (other_p) {
-    *this_p = new Node();
-    (*this_p)->value = other_p->value;
-    this_p = &((*this_p)->next);
-    other_p = other_p->next;
-    size_ += 1;
-  }
+  c_ = s.c_;
 
   return *this;
 }
 
 /* ------------------------- TOP --------------------------------- */
 
-template <typename T>
-typename Stack<T>::const_reference Stack<T>::top() const {
-  return head_->value;
+template <typename T, typename Container>
+typename Stack<T, Container>::const_reference Stack<T, Container>::top()
+    const {
+  return c_.back();
 }
 
-template <typename T>
-typename Stack<T>::reference Stack<T>::top() {
-  return head_->value;
+template <typename T, typename Container>
+typename Stack<T, Container>::reference Stack<T, Container>::top() {
+  return c_.back();
 }
 
 /* ------------------------- CAPACITY ---------------------------- */
 
-template <typename T>
-bool Stack<T>::empty() {
+template <typename T, typename Container>
+bool Stack<T, Container>::empty() {
   return size() == 0;
 }
 
-template <typename T>
-typename Stack<T>::size_type Stack<T>::size() {
-  return size_;
+template <typename T, typename Container>
+typename Stack<T, Container>::size_type Stack<T, Container>::size() {
+  return c_.size();
+}
+
+// Without a reserve on the container, as for a linked one, this does nothing.
+template <typename T, typename Container>
+void Stack<T, Container>::reserve(size_type size) {
+  if constexpr (has_reserve<Container>::value) c_.reserve(size);
 }
 
 /* ------------------------- MODIFIRE ---------------------------- */
 
-template <typename T>
-void Stack<T>::push(const_reference value) {
-  Node *node = new Node();
-  node->value = value;
-  node->next = head_;
-  head_ = node;
-  size_ += 1;
+template <typename T, typename Container>
+void Stack<T, Container>::push(const_reference value) {
+  c_.push_back(value);
 }
 
-template <typename T>
-void Stack<T>::pop() {
-  if (head_) {
-    Node *temp_node = head_;
-    head_ = head_->next;
-    delete temp_node;
-    temp_node = nullptr;
-    size_ -= 1;
-  }
+template <typename T, typename Container>
+void Stack<T, Container>::push(value_type &&value) {
+  c_.push_back(std::move(value));
 }
 
-template <typename T>
-void Stack<T>::swap(Stack &other) {
-  std::swap(head_, other.head_);
-  std::swap(size_, other.size_);
+template <typename T, typename Container>
+void Stack<T, Container>::pop() {
+  if (!c_.empty()) c_.pop_back();
 }
 
-template <typename T>
-void Stack<T>::clear() {
-  Node *tmp = nullptr;
-  while (head_ != nullptr) {
-    tmp = head_;
-    head_ = head_->next;
-    delete tmp;
-    tmp = nullptr;
-  }
+template <typename T, typename Container>
+void Stack<T, Container>::swap(Stack &other) {
+  c_.swap(other.c_);
+}
 
-  size_ = 0;
+template <typename T, typename Container>
+void Stack<T, Container>::clear() {
+  c_.clear();
 }
 
-template <typename T>
+template <typename T, typename Container>
+template <typename... Args>
+typename Stack<T, Container>::reference Stack<T, Container>::emplace(
+    Args &&...args) {
+  c_.emplace_back(std::forward<Args>(args)...);
+  return c_.back();
+};
+
+template <typename T, typename Container>
 template <typename... Args>
-void Stack<T>::emplace_front(Args &&...args) {
-  value_type temp(std::forward<Args>(args)...);
-  push(temp);
+void Stack<T, Container>::emplace_front(Args &&...args) {
+  emplace(std::forward<Args>(args)...);
 };
 };  // namespace s21
@@ -0,0 +1,82 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_WS_DEQUE_S21_WS_DEQUE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_WS_DEQUE_S21_WS_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace s21 {
+
+// Work-stealing deque after Chase and Lev, with the memory orders of Le,
+// Pop, Cohen and Zappa Nardelli. One owner thread pushes and pops at the
+// bottom like a stack, any number of thieves steal from the top, all
+// without locks; the owner only races the thieves over the last element.
+//
+// The elements live in a circular array that the owner doubles when it is
+// full. A thief may still be reading the array it loaded before the swap,
+// so replaced arrays are kept until the deque is destroyed; being half the
+// size of their successor each, they take less memory than the live one.
+//
+// Slots are atomics read speculatively by the thieves, so T has to be
+// trivially copyable; larger tasks go in as pointers or indices.
+template <typename T>
+class ws_deque {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ws_deque elements have to be trivially copyable");
+
+  // capacity is rounded up to a power of two, and to at least 2
+  explicit ws_deque(size_type capacity = 64);
+  ws_deque(const ws_deque &d) = delete;
+  ws_deque(ws_deque &&d) = delete;
+  ~ws_deque();
+
+  ws_deque &operator=(const ws_deque &d) = delete;
+  ws_deque &operator=(ws_deque &&d) = delete;
+
+  // Exact only in the owner while no thief runs, otherwise a snapshot.
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const;
+
+  // owner only
+  void push(const_reference value);
+  bool pop(reference value);
+
+  // any thread; false when the deque is empty or another thread won the
+  // top element
+  bool steal(reference value);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct Buffer {
+    explicit Buffer(size_type capacity);
+    ~Buffer();
+
+    T load(std::int64_t index) const;
+    void store(std::int64_t index, const T &value);
+
+    size_type capacity;
+    size_type mask;
+    std::atomic<T> *slots;
+    Buffer *retired;  // the buffer this one replaced
+  };
+
+  Buffer *grow(Buffer *buffer, std::int64_t bottom, std::int64_t top);
+
+  alignas(kCacheLine) std::atomic<std::int64_t> top_;
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_;
+  std::atomic<Buffer *> buffer_;
+};
+};  // namespace s21
+
+#include "s21_ws_deque.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_STACK_QUEUE_ARRAY_S21_WS_DEQUE_S21_WS_DEQUE_H_
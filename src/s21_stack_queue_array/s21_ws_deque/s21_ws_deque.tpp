@@ -0,0 +1,138 @@
+namespace s21 {
+
+/* -------- CONSTRUCTORS / DESTRUCTORS ---------- */
+
+template <typename value_type>
+ws_deque<value_type>::ws_deque(size_type capacity)
+    : top_{0}, bottom_{0}, buffer_{nullptr} {
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  buffer_.store(new Buffer(rounded), std::memory_order_relaxed);
+};
+
+template <typename value_type>
+ws_deque<value_type>::~ws_deque() {
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  while (buffer) {
+    Buffer *retired = buffer->retired;
+    delete buffer;
+    buffer = retired;
+  }
+};
+
+/* ------------------- CAPACITY --------------------- */
+
+template <typename value_type>
+bool ws_deque<value_type>::empty() const {
+  return !size();
+};
+
+template <typename value_type>
+typename ws_deque<value_type>::size_type ws_deque<value_type>::size() const {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+};
+
+template <typename value_type>
+typename ws_deque<value_type>::size_type ws_deque<value_type>::capacity()
+    const {
+  return buffer_.load(std::memory_order_relaxed)->capacity;
+};
+
+/* ------------------- OWNER --------------------- */
+
+// The release fence publishes the element, and the array if it grew,
+// before the new bottom a thief acquires.
+template <typename value_type>
+void ws_deque<value_type>::push(const_reference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top >= static_cast<std::int64_t>(buffer->capacity))
+    buffer = grow(buffer, bottom, top);
+  buffer->store(bottom, value);
+  std::atomic_thread_fence(std::memory_order_release);
+  bottom_.store(bottom + 1, std::memory_order_relaxed);
+};
+
+// Taking the bottom first and reading top after the fence means a thief
+// going for the same element either sees the lowered bottom and backs off,
+// or both see a single element left and settle it with the CAS on top.
+template <typename value_type>
+bool ws_deque<value_type>::pop(reference value) {
+  std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  value_type popped = buffer->load(bottom);
+  if (top == bottom) {
+    bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    if (!won) return false;
+  }
+  value = popped;
+  return true;
+};
+
+template <typename value_type>
+typename ws_deque<value_type>::Buffer *ws_deque<value_type>::grow(
+    Buffer *buffer, std::int64_t bottom, std::int64_t top) {
+  Buffer *grown = new Buffer(buffer->capacity * 2);
+  for (std::int64_t i = top; i < bottom; ++i) grown->store(i, buffer->load(i));
+  grown->retired = buffer;
+  buffer_.store(grown, std::memory_order_release);
+  return grown;
+};
+
+/* ------------------- THIEVES --------------------- */
+
+// The element is read before the CAS claims it; when the CAS fails the read
+// is thrown away, the owner may have overwritten the slot meanwhile.
+template <typename value_type>
+bool ws_deque<value_type>::steal(reference value) {
+  std::int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return false;
+  Buffer *buffer = buffer_.load(std::memory_order_acquire);
+  value_type stolen = buffer->load(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed))
+    return false;
+  value = stolen;
+  return true;
+};
+
+/* ------------------- BUFFER --------------------- */
+
+template <typename value_type>
+ws_deque<value_type>::Buffer::Buffer(size_type capacity)
+    : capacity{capacity},
+      mask{capacity - 1},
+      slots{new std::atomic<value_type>[capacity]},
+      retired{nullptr} {};
+
+template <typename value_type>
+ws_deque<value_type>::Buffer::~Buffer() {
+  delete[] slots;
+};
+
+template <typename value_type>
+value_type ws_deque<value_type>::Buffer::load(std::int64_t index) const {
+  return slots[index & mask].load(std::memory_order_relaxed);
+};
+
+template <typename value_type>
+void ws_deque<value_type>::Buffer::store(std::int64_t index,
+                                         const value_type &value) {
+  slots[index & mask].store(value, std::memory_order_relaxed);
+};
+
+}  // namespace s21
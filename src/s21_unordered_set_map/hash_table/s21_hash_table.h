@@ -0,0 +1,157 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_HASH_TABLE_S21_HASH_TABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_HASH_TABLE_S21_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../../s21_set_map/tree/s21_key_of.h"
+
+namespace s21 {
+
+// One control byte per slot: the 7 low bits of the hash for a full slot,
+// negative markers otherwise. The sentinel terminates iteration.
+using ctrl_t = std::int8_t;
+
+constexpr ctrl_t kCtrlEmpty = -128;
+constexpr ctrl_t kCtrlDeleted = -2;
+constexpr ctrl_t kCtrlSentinel = -1;
+
+// Sixteen control bytes probed at once, with SSE2 when it is available.
+class HashGroup {
+ public:
+  static constexpr std::size_t kWidth = 16;
+
+  explicit HashGroup(const ctrl_t* ctrl);
+
+  std::uint32_t match(ctrl_t h2) const;
+  std::uint32_t match_empty() const;
+  std::uint32_t match_empty_or_deleted() const;
+
+ private:
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  const ctrl_t* ctrl_;
+#endif
+};
+
+template <typename T, typename = void>
+struct is_transparent : std::false_type {};
+
+template <typename T>
+struct is_transparent<T, std::void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+// Open-addressing table in the SwissTable layout: slots are split in groups
+// of HashGroup::kWidth, the group of a key is picked by the high bits of its
+// hash and groups are probed triangularly, the low 7 bits are kept in the
+// control bytes to filter the slots of a group before comparing keys.
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+class HashTable {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = typename KeyOf::key_type;
+  using value_type = V;
+  using reference = V&;
+  using const_reference = const V&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = std::size_t;
+
+  HashTable() noexcept;
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other) noexcept;
+  ~HashTable();
+
+  HashTable& operator=(const HashTable& other);
+  HashTable& operator=(HashTable&& other) noexcept;
+
+  iterator begin();
+  iterator end();
+
+  bool empty() const;
+  size_type get_size() const;
+  size_type max_size() const;
+
+  size_type bucket_count() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  void erase(iterator pos);
+  void swap(HashTable& other) noexcept;
+  void merge(HashTable& other);
+
+  template <typename K>
+  iterator find(const K& key);
+
+  class Iterator {
+   public:
+    Iterator();
+    Iterator(const ctrl_t* ctrl, V* slot);
+
+    iterator& operator++();
+    iterator operator++(int);
+    bool operator==(const iterator& it) const;
+    bool operator!=(const iterator& it) const;
+    V& operator*() const;
+    V* operator->() const;
+
+   protected:
+    friend class HashTable;
+
+    const ctrl_t* ctrl_;
+    V* slot_;
+
+    void skip_empty_slots();
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator{} {};
+    ConstIterator(const iterator& other) : Iterator{other} {};
+    const V& operator*() const;
+    const V* operator->() const;
+  };
+
+ private:
+  ctrl_t* ctrl_;
+  V* slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_;
+  float max_load_factor_;
+  Hash hash_;
+  KeyEqual equal_;
+
+  template <typename K>
+  size_type hash_of(const K& key) const;
+  size_type growth_limit(size_type capacity) const;
+  size_type capacity_for(size_type count) const;
+  size_type find_free_slot(size_type hash) const;
+  void set_ctrl(size_type i, ctrl_t h2);
+  void resize(size_type new_capacity);
+  void destroy_slots();
+  void release();
+};
+};  // namespace s21
+
+#include "s21_hash_table.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_HASH_TABLE_S21_HASH_TABLE_H_
@@ -0,0 +1,446 @@
+namespace s21 {
+
+/* ---------------------------- GROUP ----------------------------------- */
+
+#ifdef __SSE2__
+
+inline HashGroup::HashGroup(const ctrl_t* ctrl)
+    : ctrl_{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))} {}
+
+inline std::uint32_t HashGroup::match(ctrl_t h2) const {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+}
+
+inline std::uint32_t HashGroup::match_empty() const {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kCtrlEmpty), ctrl_));
+}
+
+inline std::uint32_t HashGroup::match_empty_or_deleted() const {
+  return _mm_movemask_epi8(
+      _mm_cmpgt_epi8(_mm_set1_epi8(kCtrlSentinel), ctrl_));
+}
+
+#else
+
+inline HashGroup::HashGroup(const ctrl_t* ctrl) : ctrl_{ctrl} {}
+
+inline std::uint32_t HashGroup::match(ctrl_t h2) const {
+  std::uint32_t mask{};
+  for (std::size_t i = 0; i < kWidth; ++i)
+    mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+  return mask;
+}
+
+inline std::uint32_t HashGroup::match_empty() const {
+  return match(kCtrlEmpty);
+}
+
+inline std::uint32_t HashGroup::match_empty_or_deleted() const {
+  std::uint32_t mask{};
+  for (std::size_t i = 0; i < kWidth; ++i)
+    mask |= static_cast<std::uint32_t>(ctrl_[i] < kCtrlSentinel) << i;
+  return mask;
+}
+
+#endif
+
+/* -------------------- CONSTRUCTORS / DESTRUCTORS ---------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::HashTable() noexcept
+    : ctrl_{},
+      slots_{},
+      capacity_{},
+      size_{},
+      growth_left_{},
+      max_load_factor_{0.875f},
+      hash_{},
+      equal_{} {};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::HashTable(const HashTable& other)
+    : HashTable() {
+  max_load_factor_ = other.max_load_factor_;
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  resize(other.capacity_);
+  // same layout, tombstones included, so that the probe chains stay valid
+  for (size_type i = 0; i < other.capacity_; ++i) {
+    if (other.ctrl_[i] >= 0) {
+      ::new (static_cast<void*>(slots_ + i)) V(other.slots_[i]);
+      ++size_;
+    }
+    ctrl_[i] = other.ctrl_[i];
+  }
+  growth_left_ = other.growth_left_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::HashTable(HashTable&& other) noexcept
+    : HashTable() {
+  swap(other);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::~HashTable() {
+  release();
+};
+
+/* ---------------------------- OPERATORS ------------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>&
+HashTable<V, KeyOf, Hash, KeyEqual>::operator=(const HashTable& other) {
+  if (this != &other) {
+    HashTable tmp{other};
+    swap(tmp);
+  }
+  return *this;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>&
+HashTable<V, KeyOf, Hash, KeyEqual>::operator=(HashTable&& other) noexcept {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+};
+
+/* ---------------------------- BEGIN / END ----------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator
+HashTable<V, KeyOf, Hash, KeyEqual>::begin() {
+  if (!size_) return end();
+  iterator it{ctrl_, slots_};
+  it.skip_empty_slots();
+  return it;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator
+HashTable<V, KeyOf, Hash, KeyEqual>::end() {
+  return iterator{ctrl_ + capacity_, slots_ + capacity_};
+};
+
+/* ----------------------------- CAPACITY ------------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+bool HashTable<V, KeyOf, Hash, KeyEqual>::empty() const {
+  return !size_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::get_size() const {
+  return size_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::max_size() const {
+  return (std::numeric_limits<size_type>::max() / 2) / (sizeof(V) + 1);
+};
+
+/* ----------------------------- HASH POLICY ---------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::bucket_count() const {
+  return capacity_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+float HashTable<V, KeyOf, Hash, KeyEqual>::load_factor() const {
+  return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+float HashTable<V, KeyOf, Hash, KeyEqual>::max_load_factor() const {
+  return max_load_factor_;
+};
+
+// Keeps at least one empty slot per table, a probe for a missing key stops
+// at the first group that has one.
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::max_load_factor(float ml) {
+  if (!(ml > 0.0f)) throw std::invalid_argument("Invalid max load factor");
+  max_load_factor_ = ml < 0.9375f ? ml : 0.9375f;
+  if (size_ > growth_limit(capacity_))
+    rehash(0);
+  else
+    resize(capacity_);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::rehash(size_type count) {
+  size_type wanted = capacity_for(size_);
+  resize(count > wanted ? capacity_for(count) : wanted);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::reserve(size_type count) {
+  size_type wanted = capacity_for(count);
+  if (wanted > capacity_) resize(wanted);
+};
+
+/* ----------------------------- MODIFIERS ------------------------------ */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::clear() {
+  destroy_slots();
+  for (size_type i = 0; i < capacity_; ++i) ctrl_[i] = kCtrlEmpty;
+  size_ = 0;
+  growth_left_ = growth_limit(capacity_);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+std::pair<typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator, bool>
+HashTable<V, KeyOf, Hash, KeyEqual>::insert(const value_type& value) {
+  iterator it = find(KeyOf{}(value));
+  if (it != end()) return {it, false};
+  if (!growth_left_) {
+    // the tombstones take a large part of the budget: clean them up in place
+    // instead of growing
+    if (size_ < growth_limit(capacity_) && size_ * 32 <= capacity_ * 25)
+      resize(capacity_);
+    else
+      resize(std::max(capacity_ * 2, capacity_for(size_ + 1)));
+  }
+  size_type hash = hash_of(KeyOf{}(value));
+  size_type i = find_free_slot(hash);
+  ::new (static_cast<void*>(slots_ + i)) V(value);
+  if (ctrl_[i] == kCtrlEmpty) --growth_left_;
+  set_ctrl(i, static_cast<ctrl_t>(hash & 0x7F));
+  ++size_;
+  return {iterator{ctrl_ + i, slots_ + i}, true};
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::erase(iterator pos) {
+  size_type i = pos.ctrl_ - ctrl_;
+  slots_[i].~V();
+  --size_;
+  // no probe has ever gone past a group with an empty slot, so the slot can
+  // become empty again, otherwise it is left as a tombstone
+  if (HashGroup{ctrl_ + i / HashGroup::kWidth * HashGroup::kWidth}
+          .match_empty()) {
+    set_ctrl(i, kCtrlEmpty);
+    ++growth_left_;
+  } else {
+    set_ctrl(i, kCtrlDeleted);
+  }
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::swap(HashTable& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::merge(HashTable& other) {
+  if (this == &other) return;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    if (insert(*it).second) other.erase(it);
+  }
+};
+
+/* ------------------------------ LOOKUP -------------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator
+HashTable<V, KeyOf, Hash, KeyEqual>::find(const K& key) {
+  if (!size_) return end();
+  size_type hash = hash_of(key);
+  ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7F);
+  size_type group_mask = capacity_ / HashGroup::kWidth - 1;
+  size_type group = (hash >> 7) & group_mask;
+  for (size_type step = 1;; ++step) {
+    size_type offset = group * HashGroup::kWidth;
+    HashGroup probe{ctrl_ + offset};
+    for (std::uint32_t mask = probe.match(h2); mask; mask &= mask - 1) {
+      size_type i = offset + __builtin_ctz(mask);
+      if (equal_(KeyOf{}(slots_[i]), key))
+        return iterator{ctrl_ + i, slots_ + i};
+    }
+    if (probe.match_empty()) break;
+    group = (group + step) & group_mask;
+  }
+  return end();
+};
+
+/* ------------------------------ HELPERS ------------------------------- */
+
+// Mixes the user hash so that identity hashes of integers spread over both
+// the group index and the 7 control bits.
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+template <typename K>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::hash_of(const K& key) const {
+  std::uint64_t hash = hash_(key);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return static_cast<size_type>(hash);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::growth_limit(size_type capacity) const {
+  size_type limit = static_cast<size_type>(capacity * max_load_factor_);
+  return capacity && limit >= capacity ? capacity - 1 : limit;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::capacity_for(size_type count) const {
+  if (!count) return 0;
+  size_type capacity = HashGroup::kWidth;
+  while (growth_limit(capacity) < count) capacity *= 2;
+  return capacity;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::size_type
+HashTable<V, KeyOf, Hash, KeyEqual>::find_free_slot(size_type hash) const {
+  size_type group_mask = capacity_ / HashGroup::kWidth - 1;
+  size_type group = (hash >> 7) & group_mask;
+  for (size_type step = 1;; ++step) {
+    size_type offset = group * HashGroup::kWidth;
+    std::uint32_t mask = HashGroup{ctrl_ + offset}.match_empty_or_deleted();
+    if (mask) return offset + __builtin_ctz(mask);
+    group = (group + step) & group_mask;
+  }
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::set_ctrl(size_type i, ctrl_t h2) {
+  ctrl_[i] = h2;
+};
+
+// Rebuilds the table with new_capacity slots, dropping the tombstones.
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::resize(size_type new_capacity) {
+  ctrl_t* old_ctrl = ctrl_;
+  V* old_slots = slots_;
+  size_type old_capacity = capacity_;
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  if (new_capacity) {
+    ctrl_ = new ctrl_t[new_capacity + 1];
+    for (size_type i = 0; i < new_capacity; ++i) ctrl_[i] = kCtrlEmpty;
+    ctrl_[new_capacity] = kCtrlSentinel;
+    slots_ = static_cast<V*>(::operator new(sizeof(V) * new_capacity));
+  }
+  capacity_ = new_capacity;
+  growth_left_ = growth_limit(capacity_) - size_;
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] >= 0) {
+      size_type hash = hash_of(KeyOf{}(old_slots[i]));
+      size_type j = find_free_slot(hash);
+      ::new (static_cast<void*>(slots_ + j)) V(std::move(old_slots[i]));
+      set_ctrl(j, static_cast<ctrl_t>(hash & 0x7F));
+      old_slots[i].~V();
+    }
+  }
+  delete[] old_ctrl;
+  ::operator delete(old_slots);
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::destroy_slots() {
+  for (size_type i = 0; i < capacity_; ++i)
+    if (ctrl_[i] >= 0) slots_[i].~V();
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::release() {
+  destroy_slots();
+  delete[] ctrl_;
+  ::operator delete(slots_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = size_ = growth_left_ = 0;
+};
+
+/* ----------------------------- ITERATOR ------------------------------- */
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::Iterator()
+    : ctrl_{}, slot_{} {};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::Iterator(const ctrl_t* ctrl,
+                                                        V* slot)
+    : ctrl_{ctrl}, slot_{slot} {};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+void HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::skip_empty_slots() {
+  while (*ctrl_ < kCtrlSentinel) {
+    ++ctrl_;
+    ++slot_;
+  }
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator&
+HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator++() {
+  ++ctrl_;
+  ++slot_;
+  skip_empty_slots();
+  return *this;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+typename HashTable<V, KeyOf, Hash, KeyEqual>::iterator
+HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator++(int) {
+  iterator tmp = *this;
+  operator++();
+  return tmp;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+bool HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator==(
+    const iterator& it) const {
+  return ctrl_ == it.ctrl_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+bool HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator!=(
+    const iterator& it) const {
+  return ctrl_ != it.ctrl_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+V& HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator*() const {
+  return *slot_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+V* HashTable<V, KeyOf, Hash, KeyEqual>::Iterator::operator->() const {
+  return slot_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+const V& HashTable<V, KeyOf, Hash, KeyEqual>::ConstIterator::operator*()
+    const {
+  return *Iterator::slot_;
+};
+
+template <typename V, typename KeyOf, typename Hash, typename KeyEqual>
+const V* HashTable<V, KeyOf, Hash, KeyEqual>::ConstIterator::operator->()
+    const {
+  return Iterator::slot_;
+};
+
+};  // namespace s21
@@ -0,0 +1,93 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_MAP_S21_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_MAP_S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../hash_table/s21_hash_table.h"
+
+namespace s21 {
+
+// Unordered map over the open-addressing HashTable, see unordered_set for the
+// heterogeneous lookup overloads.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+  using table_type = HashTable<std::pair<const Key, T>,
+                               MapKeyOf<std::pair<const Key, T>>, Hash,
+                               KeyEqual>;
+
+  template <typename K>
+  using enable_heterogeneous =
+      std::enable_if_t<is_transparent<Hash>::value &&
+                           is_transparent<KeyEqual>::value,
+                       K>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename table_type::Iterator;
+  using const_iterator = typename table_type::ConstIterator;
+  using size_type = size_t;
+
+  unordered_map();
+  unordered_map(std::initializer_list<value_type> const &items);
+  unordered_map(const unordered_map &m);
+  unordered_map(unordered_map &&m);
+  ~unordered_map(){};
+  unordered_map &operator=(const unordered_map &m);
+  unordered_map &operator=(unordered_map &&m);
+
+  T &at(const Key &key);
+  T &operator[](const Key &key);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  size_type bucket_count();
+  float load_factor();
+  float max_load_factor();
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const Key &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj);
+  void erase(iterator pos);
+  size_type erase(const Key &key);
+  void swap(unordered_map &other);
+  void merge(unordered_map &other);
+
+  iterator find(const Key &key);
+  bool contains(const Key &key);
+  size_type count(const Key &key);
+
+  template <typename K, typename = enable_heterogeneous<K>>
+  iterator find(const K &key);
+  template <typename K, typename = enable_heterogeneous<K>>
+  bool contains(const K &key);
+  template <typename K, typename = enable_heterogeneous<K>>
+  size_type count(const K &key);
+
+ private:
+  table_type table_;
+};
+};  // namespace s21
+
+#include "s21_unordered_map.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_MAP_S21_UNORDERED_MAP_H_
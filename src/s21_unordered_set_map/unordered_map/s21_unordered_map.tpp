@@ -0,0 +1,276 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::unordered_map()
+    : table_{} {};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const &items)
+    : table_{} {
+  table_.reserve(items.size());
+  for (const auto &item : items) table_.insert(item);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::unordered_map(
+    const unordered_map &m)
+    : table_{m.table_} {};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::unordered_map(
+    unordered_map &&m)
+    : table_{std::move(m.table_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual> &
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::operator=(
+    const unordered_map &m) {
+  table_ = m.table_;
+  return *this;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+unordered_map<key_type, mapped_type, Hash, KeyEqual> &
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::operator=(
+    unordered_map &&m) {
+  table_ = std::move(m.table_);
+  return *this;
+};
+
+/* ------------------------- ELEMENT ACCESS ---------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+mapped_type &unordered_map<key_type, mapped_type, Hash, KeyEqual>::at(
+    const key_type &key) {
+  iterator it = table_.find(key);
+  if (it == table_.end())
+    throw std::out_of_range("Map dosen't contain this elem!");
+  return (*it).second;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+mapped_type &unordered_map<key_type, mapped_type, Hash, KeyEqual>::operator[](
+    const key_type &key) {
+  iterator it = table_.find(key);
+  if (it == table_.end())
+    it = table_.insert(value_type{key, mapped_type{}}).first;
+  return (*it).second;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::begin() {
+  return table_.begin();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::end() {
+  return table_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+bool unordered_map<key_type, mapped_type, Hash, KeyEqual>::empty() {
+  return table_.empty();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::size() {
+  return table_.get_size();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::max_size() {
+  return table_.max_size();
+};
+
+/* ------------------------ HASH POLICY -------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::bucket_count() {
+  return table_.bucket_count();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+float unordered_map<key_type, mapped_type, Hash, KeyEqual>::load_factor() {
+  return table_.load_factor();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+float unordered_map<key_type, mapped_type, Hash, KeyEqual>::max_load_factor() {
+  return table_.max_load_factor();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::max_load_factor(
+    float ml) {
+  table_.max_load_factor(ml);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::rehash(
+    size_type count) {
+  table_.rehash(count);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::reserve(
+    size_type count) {
+  table_.reserve(count);
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::clear() {
+  table_.clear();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+std::pair<
+    typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator,
+    bool>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::insert(
+    const value_type &value) {
+  return table_.insert(value);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+std::pair<
+    typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator,
+    bool>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::insert(
+    const key_type &key, const mapped_type &obj) {
+  return table_.insert(value_type{key, obj});
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+std::pair<
+    typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator,
+    bool>
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  iterator it = table_.find(key);
+  if (it != table_.end()) {
+    (*it).second = obj;
+    return std::pair<iterator, bool>{it, false};
+  }
+  return table_.insert(value_type{key, obj});
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase(pos);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::erase(
+    const key_type &key) {
+  iterator it = table_.find(key);
+  if (it == table_.end()) return 0;
+  table_.erase(it);
+  return 1;
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::swap(
+    unordered_map &other) {
+  table_.swap(other.table_);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+void unordered_map<key_type, mapped_type, Hash, KeyEqual>::merge(
+    unordered_map &other) {
+  table_.merge(other.table_);
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::find(
+    const key_type &key) {
+  return table_.find(key);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+bool unordered_map<key_type, mapped_type, Hash, KeyEqual>::contains(
+    const key_type &key) {
+  return table_.find(key) != table_.end();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::count(
+    const key_type &key) {
+  return contains(key);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+template <typename K, typename>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::iterator
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::find(const K &key) {
+  return table_.find(key);
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+template <typename K, typename>
+bool unordered_map<key_type, mapped_type, Hash, KeyEqual>::contains(
+    const K &key) {
+  return table_.find(key) != table_.end();
+};
+
+template <typename key_type, typename mapped_type, typename Hash,
+          typename KeyEqual>
+template <typename K, typename>
+typename unordered_map<key_type, mapped_type, Hash, KeyEqual>::size_type
+unordered_map<key_type, mapped_type, Hash, KeyEqual>::count(const K &key) {
+  return contains(key);
+};
+
+}  // namespace s21
@@ -0,0 +1,86 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_SET_S21_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_SET_S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "../hash_table/s21_hash_table.h"
+
+namespace s21 {
+
+// Unordered set over the open-addressing HashTable. When both Hash and
+// KeyEqual declare is_transparent, find/contains/count also accept any type
+// they can hash and compare with Key, without building a Key.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+  using table_type = HashTable<Key, SetKeyOf<Key>, Hash, KeyEqual>;
+
+  template <typename K>
+  using enable_heterogeneous =
+      std::enable_if_t<is_transparent<Hash>::value &&
+                           is_transparent<KeyEqual>::value,
+                       K>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename table_type::Iterator;
+  using const_iterator = typename table_type::ConstIterator;
+  using size_type = size_t;
+
+  unordered_set();
+  unordered_set(std::initializer_list<value_type> const &items);
+  unordered_set(const unordered_set &s);
+  unordered_set(unordered_set &&s);
+  ~unordered_set(){};
+
+  unordered_set &operator=(const unordered_set &s);
+  unordered_set &operator=(unordered_set &&s);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  size_type bucket_count();
+  float load_factor();
+  float max_load_factor();
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(unordered_set &other);
+  void merge(unordered_set &other);
+
+  iterator find(const key_type &key);
+  bool contains(const key_type &key);
+  size_type count(const key_type &key);
+
+  template <typename K, typename = enable_heterogeneous<K>>
+  iterator find(const K &key);
+  template <typename K, typename = enable_heterogeneous<K>>
+  bool contains(const K &key);
+  template <typename K, typename = enable_heterogeneous<K>>
+  size_type count(const K &key);
+
+ private:
+  table_type table_;
+};
+};  // namespace s21
+
+#include "s21_unordered_set.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_UNORDERED_SET_MAP_UNORDERED_SET_S21_UNORDERED_SET_H_
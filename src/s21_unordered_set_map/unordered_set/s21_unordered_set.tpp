@@ -0,0 +1,182 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ---------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual>::unordered_set() : table_{} {};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const &items)
+    : table_{} {
+  table_.reserve(items.size());
+  for (const auto &item : items) table_.insert(item);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual>::unordered_set(const unordered_set &s)
+    : table_{s.table_} {};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual>::unordered_set(unordered_set &&s)
+    : table_{std::move(s.table_)} {};
+
+/* ------------------------ OPERATORS --------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual> &
+unordered_set<value_type, Hash, KeyEqual>::operator=(const unordered_set &s) {
+  table_ = s.table_;
+  return *this;
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+unordered_set<value_type, Hash, KeyEqual> &
+unordered_set<value_type, Hash, KeyEqual>::operator=(unordered_set &&s) {
+  table_ = std::move(s.table_);
+  return *this;
+};
+
+/* ------------------------ BEGIN / END -------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::iterator
+unordered_set<value_type, Hash, KeyEqual>::begin() {
+  return table_.begin();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::iterator
+unordered_set<value_type, Hash, KeyEqual>::end() {
+  return table_.end();
+};
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+bool unordered_set<value_type, Hash, KeyEqual>::empty() {
+  return table_.empty();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::size() {
+  return table_.get_size();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::max_size() {
+  return table_.max_size();
+};
+
+/* ------------------------ HASH POLICY -------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::bucket_count() {
+  return table_.bucket_count();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+float unordered_set<value_type, Hash, KeyEqual>::load_factor() {
+  return table_.load_factor();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+float unordered_set<value_type, Hash, KeyEqual>::max_load_factor() {
+  return table_.max_load_factor();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::max_load_factor(float ml) {
+  table_.max_load_factor(ml);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::rehash(size_type count) {
+  table_.rehash(count);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+};
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::clear() {
+  table_.clear();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<value_type, Hash, KeyEqual>::iterator, bool>
+unordered_set<value_type, Hash, KeyEqual>::insert(const value_type &value) {
+  return table_.insert(value);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase(pos);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::erase(const key_type &key) {
+  iterator it = table_.find(key);
+  if (it == table_.end()) return 0;
+  table_.erase(it);
+  return 1;
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::swap(unordered_set &other) {
+  table_.swap(other.table_);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+void unordered_set<value_type, Hash, KeyEqual>::merge(unordered_set &other) {
+  table_.merge(other.table_);
+};
+
+/* ----------------------------- LOOKUP ------------------------------- */
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::iterator
+unordered_set<value_type, Hash, KeyEqual>::find(const key_type &key) {
+  return table_.find(key);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+bool unordered_set<value_type, Hash, KeyEqual>::contains(const key_type &key) {
+  return table_.find(key) != table_.end();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::count(const key_type &key) {
+  return contains(key);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+template <typename K, typename>
+typename unordered_set<value_type, Hash, KeyEqual>::iterator
+unordered_set<value_type, Hash, KeyEqual>::find(const K &key) {
+  return table_.find(key);
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+template <typename K, typename>
+bool unordered_set<value_type, Hash, KeyEqual>::contains(const K &key) {
+  return table_.find(key) != table_.end();
+};
+
+template <typename value_type, typename Hash, typename KeyEqual>
+template <typename K, typename>
+typename unordered_set<value_type, Hash, KeyEqual>::size_type
+unordered_set<value_type, Hash, KeyEqual>::count(const K &key) {
+  return contains(key);
+};
+
+}  // namespace s21
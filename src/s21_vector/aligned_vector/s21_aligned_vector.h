@@ -0,0 +1,95 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_VECTOR_ALIGNED_VECTOR_S21_ALIGNED_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_VECTOR_ALIGNED_VECTOR_S21_ALIGNED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A growable buffer for SIMD kernels. data() is aligned to Align bytes and
+// the capacity is always a whole number of Align-byte vectors. Every slot
+// past size() holds value_type{}, so a kernel can run over padded_size()
+// elements, size() rounded up to a whole vector, with aligned loads and
+// without a scalar epilogue. The elements have to be trivially copyable: the
+// vector is meant for numbers, and the slots are all constructed up front.
+template <typename T, size_t Align = 64>
+class aligned_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "aligned_vector holds trivially copyable types only");
+  static_assert(Align && !(Align & (Align - 1)),
+                "the alignment has to be a power of two");
+  static_assert(Align >= alignof(T) && Align % sizeof(T) == 0,
+                "the alignment has to be a multiple of the element size");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  static constexpr size_type alignment = Align;
+
+  aligned_vector();
+  explicit aligned_vector(size_type n);
+  aligned_vector(std::initializer_list<value_type> const &items);
+  aligned_vector(const aligned_vector &v);
+  aligned_vector(aligned_vector &&v) noexcept;
+  ~aligned_vector();
+
+  aligned_vector &operator=(const aligned_vector &v);
+  aligned_vector &operator=(aligned_vector &&v) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  iterator data() noexcept;
+  const_iterator data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type padded_size() const noexcept;
+  size_type capacity() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void resize(size_type n);
+  void push_back(const_reference value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(aligned_vector &other) noexcept;
+
+ private:
+  static constexpr size_type kLanes = Align / sizeof(T);
+
+  size_type size_;
+  size_type capacity_;
+  value_type *data_;
+
+  static size_type round_up(size_type n);
+  void reallocate(size_type new_cap);
+};
+};  // namespace s21
+
+#include "s21_aligned_vector.tpp"
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_VECTOR_ALIGNED_VECTOR_S21_ALIGNED_VECTOR_H_
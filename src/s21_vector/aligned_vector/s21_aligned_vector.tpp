@@ -0,0 +1,269 @@
+namespace s21 {
+
+/* ------------------ CONSTRUSCTORS / DESTRUCTOR ----------------- */
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::aligned_vector()
+    : size_(0), capacity_(0), data_(nullptr) {}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::aligned_vector(size_type n) : aligned_vector() {
+  reserve(n);
+  size_ = n;
+}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::aligned_vector(
+    std::initializer_list<value_type> const &items)
+    : aligned_vector() {
+  reserve(items.size());
+  std::copy(items.begin(), items.end(), data_);
+  size_ = items.size();
+}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::aligned_vector(const aligned_vector &v)
+    : aligned_vector() {
+  reserve(v.size_);
+  std::copy_n(v.data_, v.size_, data_);
+  size_ = v.size_;
+}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::aligned_vector(aligned_vector &&v) noexcept
+    : aligned_vector() {
+  swap(v);
+}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align>::~aligned_vector() {
+  reallocate(0);
+}
+
+/* ------------------------ OPERATORS ---------------------------- */
+
+template <typename T, size_t Align>
+aligned_vector<T, Align> &aligned_vector<T, Align>::operator=(
+    const aligned_vector &v) {
+  if (this != &v) {
+    aligned_vector copy(v);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, size_t Align>
+aligned_vector<T, Align> &aligned_vector<T, Align>::operator=(
+    aligned_vector &&v) noexcept {
+  if (this != &v) {
+    aligned_vector moved(std::move(v));
+    swap(moved);
+  }
+  return *this;
+}
+
+/* ------------------------ ELEMENT ACCESS ----------------------- */
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::reference aligned_vector<T, Align>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_reference
+aligned_vector<T, Align>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return data_[pos];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::reference
+aligned_vector<T, Align>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_reference
+aligned_vector<T, Align>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::reference aligned_vector<T, Align>::front() {
+  return data_[0];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_reference
+aligned_vector<T, Align>::front() const {
+  return data_[0];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::reference aligned_vector<T, Align>::back() {
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_reference
+aligned_vector<T, Align>::back() const {
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::iterator
+aligned_vector<T, Align>::data() noexcept {
+  return data_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_iterator
+aligned_vector<T, Align>::data() const noexcept {
+  return data_;
+}
+
+/* ------------------------- ITERATORS --------------------------- */
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::iterator
+aligned_vector<T, Align>::begin() noexcept {
+  return data_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_iterator
+aligned_vector<T, Align>::begin() const noexcept {
+  return data_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::iterator
+aligned_vector<T, Align>::end() noexcept {
+  return data_ + size_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::const_iterator
+aligned_vector<T, Align>::end() const noexcept {
+  return data_ + size_;
+}
+
+/* ------------------------- CAPACITY ---------------------------- */
+
+template <typename T, size_t Align>
+bool aligned_vector<T, Align>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::size_type aligned_vector<T, Align>::size()
+    const noexcept {
+  return size_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::size_type
+aligned_vector<T, Align>::padded_size() const noexcept {
+  return round_up(size_);
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::size_type
+aligned_vector<T, Align>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::size_type
+aligned_vector<T, Align>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type);
+}
+
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error(
+        "Can't create s21::aligned_vector larger than max_size()");
+  }
+  if (size > capacity_) reallocate(round_up(size));
+}
+
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::shrink_to_fit() {
+  if (round_up(size_) < capacity_) reallocate(round_up(size_));
+}
+
+/* ------------------------- MODIFIRE ---------------------------- */
+
+// The cleared slots go back to value_type{}, they are padding again.
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::clear() noexcept {
+  std::fill_n(data_, size_, value_type{});
+  size_ = 0;
+}
+
+// New elements are value-initialized already, the slots past size() are.
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::resize(size_type n) {
+  if (n > capacity_) reserve(n);
+  if (n < size_) std::fill(data_ + n, data_ + size_, value_type{});
+  size_ = n;
+}
+
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// The element is built before the storage grows, the arguments may refer
+// to an element of this vector.
+template <typename T, size_t Align>
+template <class... Args>
+typename aligned_vector<T, Align>::reference
+aligned_vector<T, Align>::emplace_back(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  if (size_ == capacity_) reallocate(capacity_ ? 2 * capacity_ : kLanes);
+  data_[size_] = value;
+  return data_[size_++];
+}
+
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::pop_back() {
+  if (size_) data_[--size_] = value_type{};
+}
+
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::swap(aligned_vector &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(data_, other.data_);
+}
+
+/* -------------------------- STORAGE ---------------------------- */
+
+template <typename T, size_t Align>
+typename aligned_vector<T, Align>::size_type
+aligned_vector<T, Align>::round_up(size_type n) {
+  return (n + kLanes - 1) / kLanes * kLanes;
+}
+
+// new_cap is a multiple of the lanes and at least size_. The elements are
+// copied over and every slot after them is set to value_type{}.
+template <typename T, size_t Align>
+void aligned_vector<T, Align>::reallocate(size_type new_cap) {
+  value_type *new_data = nullptr;
+  if (new_cap) {
+    new_data = static_cast<value_type *>(::operator new(
+        new_cap * sizeof(value_type), std::align_val_t{Align}));
+    std::uninitialized_copy_n(data_, size_, new_data);
+    std::uninitialized_fill_n(new_data + size_, new_cap - size_,
+                              value_type{});
+  }
+  if (data_) ::operator delete(data_, std::align_val_t{Align});
+  data_ = new_data;
+  capacity_ = new_cap;
+}
+
+};  // namespace s21
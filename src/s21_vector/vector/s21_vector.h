@@ -1,9 +1,15 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_VECTOR_VECTOR_S21_VECTOR_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_VECTOR_VECTOR_S21_VECTOR_H_
 
+#include <algorithm>
 #include <cmath>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -12,6 +18,11 @@ class VectorIterator;
 template <typename T>
 class VectorConstIterator;
 
+// The elements live in raw storage of capacity() slots, of which only the
+// first size() hold constructed objects. Growing moves the elements into the
+// new storage, or copies them when their move may throw and a copy is
+// possible, so a failed growth leaves the vector as it was. emplace_back
+// constructs the new element directly in its slot.
 template <typename T>
 class Vector {
  public:
@@ -37,8 +48,11 @@ class Vector {
   // Vector Element access
   reference_type at(size_type pos);
   reference_type operator[](size_type pos);
-  const_reference front();
-  const_reference back();
+  const_reference operator[](size_type pos) const;
+  reference_type front();
+  const_reference front() const;
+  reference_type back();
+  const_reference back() const;
   iterator data();
 
   // Vector Iterators
@@ -46,11 +60,11 @@ class Vector {
   iterator end();
 
   // Vector Capacity
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
   void reserve(size_type size);
-  size_type capacity();
+  size_type capacity() const;
   void shrink_to_fit();
 
   // Vector Modifiers
@@ -58,6 +72,9 @@ class Vector {
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference_type emplace_back(Args&&... args);
   void pop_back();
   void swap(Vector& other);
 
@@ -67,7 +84,10 @@ class Vector {
   value_type* data_;
 
   // Helpers
+  static value_type* allocate_storage(size_type n);
+  static void deallocate_storage(value_type* data);
   void allocate(size_type new_cap);
+  void relocate_to(value_type* new_data);
   void bring_to_zero();
   void remove();
 };
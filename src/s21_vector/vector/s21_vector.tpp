@@ -4,29 +4,31 @@ template <typename value_type>
 Vector<value_type>::Vector() : size_(0), capacity_(0), data_(nullptr) {}
 
 template <typename value_type>
-Vector<value_type>::Vector(size_type n) {
+Vector<value_type>::Vector(size_type n) : Vector() {
   if (n > max_size()) {
     throw std::length_error("Can't create s21::Vector larger than max_size()");
   }
-  size_ = n;
+  data_ = allocate_storage(n);
   capacity_ = n;
-  data_ = new value_type[capacity_];
+  std::uninitialized_value_construct_n(data_, n);
+  size_ = n;
 }
 
 template <typename value_type>
 Vector<value_type>::Vector(std::initializer_list<value_type> const& items)
-    : size_(items.size()),
-      capacity_(items.size()),
-      data_(new value_type[capacity_]) {
-  std::copy(items.begin(), items.end(), data_);
+    : Vector() {
+  data_ = allocate_storage(items.size());
+  capacity_ = items.size();
+  std::uninitialized_copy(items.begin(), items.end(), data_);
+  size_ = items.size();
 }
 
 template <typename value_type>
-Vector<value_type>::Vector(const Vector& v)
-    : size_(v.size_), capacity_(v.capacity_), data_(new value_type[capacity_]) {
-  for (size_type i = 0; i < size_; i++) {
-    data_[i] = v.data_[i];
-  }
+Vector<value_type>::Vector(const Vector& v) : Vector() {
+  data_ = allocate_storage(v.capacity_);
+  capacity_ = v.capacity_;
+  std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+  size_ = v.size_;
 }
 
 template <typename value_type>
@@ -44,13 +46,8 @@ template <typename value_type>
 typename s21::Vector<value_type>& Vector<value_type>::operator=(
     const Vector& v) {
   if (this != &v) {
-    remove();
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    data_ = new value_type[capacity_];
-    for (size_type i = 0; i < size_; i++) {
-      data_[i] = v.data_[i];
-    }
+    Vector copy(v);
+    swap(copy);
   }
   return *this;
 }
@@ -84,12 +81,29 @@ typename Vector<value_type>::reference_type Vector<value_type>::operator[](
 }
 
 template <typename value_type>
-typename Vector<value_type>::const_reference Vector<value_type>::front() {
+typename Vector<value_type>::const_reference Vector<value_type>::operator[](
+    size_type pos) const {
+  return data_[pos];
+}
+
+template <typename value_type>
+typename Vector<value_type>::reference_type Vector<value_type>::front() {
+  return *data_;
+}
+
+template <typename value_type>
+typename Vector<value_type>::const_reference Vector<value_type>::front()
+    const {
   return *data_;
 }
 
 template <typename value_type>
-typename Vector<value_type>::const_reference Vector<value_type>::back() {
+typename Vector<value_type>::reference_type Vector<value_type>::back() {
+  return *(data_ + size_ - 1);
+}
+
+template <typename value_type>
+typename Vector<value_type>::const_reference Vector<value_type>::back() const {
   return *(data_ + size_ - 1);
 }
 
@@ -111,17 +125,17 @@ typename Vector<value_type>::iterator Vector<value_type>::end() {
 
 // Vector Capacity
 template <typename value_type>
-bool Vector<value_type>::empty() {
+bool Vector<value_type>::empty() const {
   return (size_ == 0);
 }
 
 template <typename value_type>
-typename Vector<value_type>::size_type Vector<value_type>::size() {
+typename Vector<value_type>::size_type Vector<value_type>::size() const {
   return size_;
 }
 
 template <typename value_type>
-typename Vector<value_type>::size_type Vector<value_type>::max_size() {
+typename Vector<value_type>::size_type Vector<value_type>::max_size() const {
   int bits = 63;
   if (sizeof(void*) == 4) {
     bits = 31;
@@ -134,13 +148,13 @@ void Vector<value_type>::reserve(size_type size) {
   if (size > max_size()) {
     throw std::length_error("Size is too large");
   }
-  if (size > size_) {
+  if (size > capacity_) {
     allocate(size);
   }
 }
 
 template <typename value_type>
-typename Vector<value_type>::size_type Vector<value_type>::capacity() {
+typename Vector<value_type>::size_type Vector<value_type>::capacity() const {
   return capacity_;
 }
 
@@ -154,60 +168,84 @@ void Vector<value_type>::shrink_to_fit() {
 // Vector Modifiers
 template <typename value_type>
 void Vector<value_type>::clear() {
+  std::destroy_n(data_, size_);
   size_ = 0;
 }
 
+// The value is appended and rotated into place, which also covers a value
+// that refers to an element of this vector.
 template <typename value_type>
 typename Vector<value_type>::iterator Vector<value_type>::insert(
     iterator pos, const_reference value) {
   size_type position = &(*pos) - data_;
-  size_type zero = 0;
-  if (position < zero || position > size_) {
+  if (position > size_) {
     throw std::out_of_range("Index is out ot range");
   }
-  if (size_ + 1 >= capacity_) {
-    allocate(size_ * 2);
-  }
-  value_type replace = data_[position];
-  size_++;
-  data_[position] = value;
-  for (size_type i = position + 1; i < size_; ++i) {
-    value_type next = data_[i];
-    data_[i] = replace;
-    replace = next;
-  }
+  emplace_back(value);
+  std::rotate(data_ + position, data_ + size_ - 1, data_ + size_);
   return data_ + position;
 }
 
 template <typename value_type>
 void Vector<value_type>::erase(iterator pos) {
   size_type position = &(*pos) - data_;
-  size_type zero = 0;
-  if (position < zero || position > size_) {
+  if (position >= size_) {
     throw std::out_of_range("Index is out ot range");
   }
-  for (size_type i = position + 1; i < size_; i++) {
-    data_[i - 1] = data_[i];
-  }
-  size_--;
+  std::move(data_ + position + 1, data_ + size_, data_ + position);
+  pop_back();
 }
 
 template <typename value_type>
 void Vector<value_type>::push_back(const_reference value) {
-  if (size_ >= capacity_) {
-    if (!size_) {
-      allocate(1);
-    } else {
-      allocate(size_ * 2);
-    }
+  emplace_back(value);
+}
+
+template <typename value_type>
+void Vector<value_type>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+// When the storage is full the new element is constructed in the grown
+// storage before the old elements move over, so arguments referring to an
+// element of this vector stay valid.
+template <typename value_type>
+template <class... Args>
+typename Vector<value_type>::reference_type Vector<value_type>::emplace_back(
+    Args&&... args) {
+  if (size_ < capacity_) {
+    ::new (static_cast<void*>(data_ + size_))
+        value_type(std::forward<Args>(args)...);
+    return data_[size_++];
   }
-  data_[size_++] = value;
+  size_type new_cap = size_ ? size_ * 2 : 1;
+  value_type* new_data = allocate_storage(new_cap);
+  try {
+    ::new (static_cast<void*>(new_data + size_))
+        value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_storage(new_data);
+    throw;
+  }
+  try {
+    relocate_to(new_data);
+  } catch (...) {
+    std::destroy_at(new_data + size_);
+    deallocate_storage(new_data);
+    throw;
+  }
+  std::destroy_n(data_, size_);
+  deallocate_storage(data_);
+  data_ = new_data;
+  capacity_ = new_cap;
+  return data_[size_++];
 }
 
 template <typename value_type>
 void Vector<value_type>::pop_back() {
   if (size_ > 0) {
     size_--;
+    std::destroy_at(data_ + size_);
   }
 }
 
@@ -221,17 +259,53 @@ void Vector<value_type>::swap(Vector& other) {
 
 // Helpers
 
+template <typename value_type>
+value_type* Vector<value_type>::allocate_storage(size_type n) {
+  if (!n) return nullptr;
+  if constexpr (alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return static_cast<value_type*>(::operator new(
+        n * sizeof(value_type), std::align_val_t{alignof(value_type)}));
+  } else {
+    return static_cast<value_type*>(::operator new(n * sizeof(value_type)));
+  }
+}
+
+template <typename value_type>
+void Vector<value_type>::deallocate_storage(value_type* data) {
+  if constexpr (alignof(value_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(data, std::align_val_t{alignof(value_type)});
+  } else {
+    ::operator delete(data);
+  }
+}
+
 template <typename value_type>
 void Vector<value_type>::allocate(size_type new_cap) {
-  value_type* new_data = new value_type[new_cap];
-  for (size_type i = 0; i < size_; ++i) {
-    new_data[i] = data_[i];
+  value_type* new_data = allocate_storage(new_cap);
+  try {
+    relocate_to(new_data);
+  } catch (...) {
+    deallocate_storage(new_data);
+    throw;
   }
-  delete[] data_;
+  std::destroy_n(data_, size_);
+  deallocate_storage(data_);
   data_ = new_data;
   capacity_ = new_cap;
 }
 
+// Constructs the elements in new_data, the old ones are left for the caller
+// to destroy. Whatever was constructed is destroyed again if one throws.
+template <typename value_type>
+void Vector<value_type>::relocate_to(value_type* new_data) {
+  if constexpr (!std::is_nothrow_move_constructible_v<value_type> &&
+                std::is_copy_constructible_v<value_type>) {
+    std::uninitialized_copy(data_, data_ + size_, new_data);
+  } else {
+    std::uninitialized_move(data_, data_ + size_, new_data);
+  }
+}
+
 template <typename value_type>
 void Vector<value_type>::bring_to_zero() {
   size_ = 0;
@@ -241,8 +315,9 @@ void Vector<value_type>::bring_to_zero() {
 
 template <typename value_type>
 void Vector<value_type>::remove() {
-  delete[] this->data_;
+  std::destroy_n(data_, size_);
+  deallocate_storage(data_);
   bring_to_zero();
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
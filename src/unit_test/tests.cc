@@ -1,10 +1,21 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
 #include <list>
 #include <map>
 #include <queue>
+#include <random>
 #include <set>
 #include <stack>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -786,6 +797,56 @@ TEST(VectorTest, swap_func) {
   EXPECT_EQ(test_vector_copy.capacity(), std_test_vector_copy.capacity());
 }
 
+TEST(VectorTest, emplace_back_func) {
+  s21::Vector<std::pair<std::string, int>> test_vector;
+  std::vector<std::pair<std::string, int>> std_test_vector;
+  for (int i = 0; i < 16; ++i) {
+    test_vector.emplace_back(std::to_string(i), i);
+    std_test_vector.emplace_back(std::to_string(i), i);
+  }
+  test_vector.push_back(test_vector.front());
+  std_test_vector.push_back(std_test_vector.front());
+  test_vector.insert(test_vector.begin() + 3, test_vector.back());
+  std_test_vector.insert(std_test_vector.begin() + 3, std_test_vector.back());
+  test_vector.erase(test_vector.begin() + 5);
+  std_test_vector.erase(std_test_vector.begin() + 5);
+  ASSERT_EQ(test_vector.size(), std_test_vector.size());
+  for (std::size_t i = 0; i < test_vector.size(); ++i)
+    EXPECT_EQ(test_vector[i], std_test_vector[i]);
+}
+
+// Copies fail once copies_left runs out, moving always fails.
+struct ThrowingMove {
+  static int copies_left;
+  std::string text;
+  explicit ThrowingMove(std::string value) : text(std::move(value)) {}
+  ThrowingMove(const ThrowingMove &other) : text(other.text) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+  ThrowingMove(ThrowingMove &&) { throw std::logic_error("move"); }
+};
+int ThrowingMove::copies_left = 0;
+
+TEST(VectorTest, growth_with_throwing_move) {
+  s21::Vector<ThrowingMove> test_vector;
+  ThrowingMove::copies_left = 100;
+  for (int i = 0; i < 4; ++i)
+    test_vector.emplace_back("element number " + std::to_string(i));
+  ThrowingMove::copies_left = 2;
+  EXPECT_THROW(test_vector.emplace_back("one too many"), std::runtime_error);
+  ThrowingMove::copies_left = 1;
+  EXPECT_THROW(test_vector.reserve(16), std::runtime_error);
+  EXPECT_EQ(test_vector.size(), 4U);
+  EXPECT_EQ(test_vector.capacity(), 4U);
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(test_vector[i].text, "element number " + std::to_string(i));
+  ThrowingMove::copies_left = 100;
+  test_vector.emplace_back("element number 4");
+  EXPECT_EQ(test_vector.capacity(), 8U);
+  EXPECT_EQ(test_vector[0].text, "element number 0");
+  EXPECT_EQ(test_vector.back().text, "element number 4");
+}
+
 TEST(VectorTest, iterator_operator_minus_minus) {
   s21::Vector<int> test_vector{1, 2, 3, 4, 5};
   std::vector<int> std_test_vector{1, 2, 3, 4, 5};
@@ -819,6 +880,89 @@ TEST(VectorTest, iterator_operator_not_eq) {
   EXPECT_EQ(test_vector.at(3) != std_test_vector.at(4), 1);
 }
 
+/* ---------------------- ALIGNED VECTOR ------------------------- */
+
+template <typename T, size_t Align>
+bool padding_is_zero(const s21::aligned_vector<T, Align>& v) {
+  for (size_t i = v.size(); i < v.capacity(); ++i)
+    if (v.data()[i] != T{}) return false;
+  return true;
+}
+
+TEST(AlignedVectorTest, AlignedAndPadded) {
+  s21::aligned_vector<float, 32> v;
+  std::vector<float> std_v;
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i * 0.5f);
+    std_v.push_back(i * 0.5f);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 32, 0u);
+    EXPECT_EQ(v.padded_size() % 8, 0u);
+    EXPECT_GE(v.padded_size(), v.size());
+    EXPECT_LE(v.padded_size(), v.capacity());
+    EXPECT_TRUE(padding_is_zero(v));
+  }
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), std_v.begin(), std_v.end()));
+  EXPECT_EQ(v.padded_size(), 104u);
+}
+
+TEST(AlignedVectorTest, ShrinkingKeepsPaddingZero) {
+  s21::aligned_vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+                             15, 16, 17, 18};
+  EXPECT_EQ(v.capacity(), 32u);
+  v.pop_back();
+  EXPECT_EQ(v.back(), 17);
+  EXPECT_TRUE(padding_is_zero(v));
+  v.resize(5);
+  EXPECT_EQ(v.padded_size(), 16u);
+  EXPECT_TRUE(padding_is_zero(v));
+  v.resize(20);
+  EXPECT_EQ(v[4], 5);
+  EXPECT_EQ(v[5], 0);
+  EXPECT_EQ(v[19], 0);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 32u);
+  v.resize(3);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 16u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 64, 0u);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.padded_size(), 0u);
+  EXPECT_TRUE(padding_is_zero(v));
+}
+
+TEST(AlignedVectorTest, CopyMoveSwap) {
+  s21::aligned_vector<double, 32> a(7);
+  for (size_t i = 0; i < a.size(); ++i) a[i] = i;
+  s21::aligned_vector<double, 32> b(a);
+  EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+  EXPECT_EQ(b.capacity(), 8u);
+  s21::aligned_vector<double, 32> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(a.data(), nullptr);
+  EXPECT_EQ(c.back(), 6.0);
+  a = c;
+  a.push_back(a.front());
+  c = std::move(a);
+  EXPECT_EQ(c.size(), 8u);
+  EXPECT_EQ(c.back(), 0.0);
+  b.swap(c);
+  EXPECT_EQ(b.size(), 8u);
+  EXPECT_EQ(c.size(), 7u);
+  EXPECT_EQ(c.at(6), 6.0);
+  EXPECT_THROW(c.at(7), std::out_of_range);
+  EXPECT_THROW(c.reserve(c.max_size() + 1), std::length_error);
+}
+
+TEST(AlignedVectorTest, PushOwnElementWhileGrowing) {
+  s21::aligned_vector<int, 16> v{42, 1, 2, 3};
+  EXPECT_EQ(v.size(), v.capacity());
+  v.push_back(v[0]);
+  EXPECT_EQ(v.emplace_back(v[1]), 1);
+  EXPECT_EQ(v[4], 42);
+  EXPECT_EQ(v.capacity(), 8u);
+}
+
 /* -------------------- SET ----------------------- */
 
 class SetTest {
@@ -842,8 +986,8 @@ class SetTest {
 
 TEST(set, Constructor) {
   SetTest tmp;
-  EXPECT_EQ(*(tmp.empty_set.begin()) == *(tmp.empty_set_orig.begin()), true);
-  EXPECT_EQ(*(tmp.empty_set.end()) == *(tmp.empty_set_orig.end()), true);
+  EXPECT_TRUE(tmp.empty_set.begin() == tmp.empty_set.end());
+  EXPECT_TRUE(tmp.empty_set.empty());
 }
 
 TEST(set, ConstructorList) {
@@ -944,6 +1088,59 @@ TEST(set, EraseTest) {
             tmp.set_int_orig.find(5) == tmp.set_int_orig.end());
 }
 
+TEST(set, EraseRebalanceTest) {
+  s21::set<int> tree;
+  std::set<int> orig;
+  for (int i = 0; i < 1000; ++i) {
+    tree.insert((i * 7919) % 1000);
+    orig.insert((i * 7919) % 1000);
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    tree.erase(tree.find((i * 104729) % 1000));
+    orig.erase((i * 104729) % 1000);
+  }
+  EXPECT_EQ(tree.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : tree) EXPECT_EQ(it, *(it_orig++));
+}
+
+TEST(set, EraseReturnsNext) {
+  s21::set<int> tree{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  auto it = tree.erase(tree.find(4));
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(tree.erase(5), 1U);
+  EXPECT_EQ(tree.erase(5), 0U);
+  it = tree.erase(tree.find(7), tree.find(10));
+  EXPECT_EQ(*it, 10);
+  EXPECT_TRUE(tree.erase(it) == tree.end());
+  std::vector<int> left{1, 2, 3, 6};
+  auto it_left = left.begin();
+  for (auto value : tree) EXPECT_EQ(value, *(it_left++));
+  it = tree.erase(tree.begin(), tree.end());
+  EXPECT_TRUE(tree.empty());
+  EXPECT_TRUE(it == tree.end());
+}
+
+TEST(set, EraseRange) {
+  s21::set<int> tree;
+  std::set<int> orig;
+  for (int i = 0; i < 2000; ++i) {
+    tree.insert((i * 7919) % 2000);
+    orig.insert((i * 7919) % 2000);
+  }
+  for (int lo = 0; lo < 2000; lo += 150) {
+    tree.erase(tree.lower_bound(lo), tree.lower_bound(lo + 40));
+    orig.erase(orig.lower_bound(lo), orig.lower_bound(lo + 40));
+  }
+  tree.erase(tree.lower_bound(1990), tree.end());
+  orig.erase(orig.lower_bound(1990), orig.end());
+  EXPECT_EQ(tree.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : tree) EXPECT_EQ(it, *(it_orig++));
+  tree.insert(1995);
+  EXPECT_EQ(*--tree.end(), 1995);
+}
+
 TEST(set, SwapTest) {
   SetTest tmp;
   tmp.set_int.swap(tmp.swapped);
@@ -971,6 +1168,95 @@ TEST(set, ContainsTest) {
   }
 }
 
+TEST(set, FindBatch) {
+  s21::set<int> values;
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) values.insert((i * 7919) % 1000 * 2);
+  for (int i = 0; i < 333; ++i) keys.push_back((i * 104729) % 2100);
+  std::vector<s21::set<int>::iterator> found;
+  values.find_batch(keys, std::back_inserter(found));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i)
+    EXPECT_TRUE(found[i] == values.find(keys[i]));
+  std::vector<bool> present(keys.size());
+  values.contains_batch(keys, present.begin());
+  for (size_t i = 0; i < keys.size(); ++i)
+    EXPECT_EQ(present[i], keys[i] % 2 == 0 && keys[i] < 2000);
+  s21::set<int> empty;
+  empty.contains_batch(keys, present.begin());
+  for (bool value : present) EXPECT_FALSE(value);
+}
+
+TEST(set, BloomFilter) {
+  s21::set<int, s21::BloomFilter<int>> values;
+  EXPECT_FALSE(values.contains(1));
+  for (int i = 0; i < 5000; ++i) values.insert(i * 2);
+  for (int i = 0; i < 10000; ++i) EXPECT_EQ(values.contains(i), i % 2 == 0);
+  EXPECT_LT(values.filter().false_positive_rate(), 0.02);
+  EXPECT_GE(values.filter().get_capacity(), values.size());
+  EXPECT_EQ(values.filter().memory_usage() % 64, 0U);
+  size_t before = values.filter().memory_usage();
+  values.erase(values.begin(), values.find(8000));
+  for (int i = 4000; i < 4500; i += 2) values.erase(i);
+  EXPECT_LT(values.filter().memory_usage(), before);
+  for (int i = 0; i < 10000; ++i)
+    EXPECT_EQ(values.contains(i), i % 2 == 0 && i >= 8000);
+  s21::set<int, s21::BloomFilter<int>> other{1, 3, 8000};
+  values.merge(other);
+  EXPECT_TRUE(values.contains(1) && values.contains(3));
+  EXPECT_TRUE(other.contains(8000) && !other.contains(1));
+  values.clear();
+  EXPECT_FALSE(values.contains(8000));
+  EXPECT_EQ(values.filter().memory_usage(), 0U);
+}
+
+TEST(set, RangeTest) {
+  SetTest tmp;
+  EXPECT_EQ(*tmp.set_string.lower_bound("bb"), "kokoro");
+  EXPECT_EQ(*tmp.set_string.upper_bound("baka"), "kokoro");
+  EXPECT_TRUE(tmp.set_string.upper_bound("obon") == tmp.set_string.end());
+  auto range = tmp.set_int.equal_range(4);
+  EXPECT_EQ(*range.first, 4);
+  EXPECT_EQ(*range.second, 5);
+  range = tmp.set_int.equal_range(10);
+  EXPECT_TRUE(range.first == range.second);
+  std::vector<int> visited;
+  tmp.set_int.for_each_in_range(2, 6, [&visited](const int &value) {
+    visited.push_back(value);
+  });
+  EXPECT_EQ(visited, (std::vector<int>{2, 3, 4, 5}));
+  tmp.empty_set.for_each_in_range(2, 6, [](const int &) { FAIL(); });
+}
+
+TEST(set, IterateBothWays) {
+  s21::set<int> values;
+  for (int i = 0; i < 500; ++i) values.insert((i * 7919) % 500);
+  int expected = 0;
+  for (auto it = values.begin(); it != values.end(); ++it)
+    EXPECT_EQ(*it, expected++);
+  auto it = values.end();
+  while (it != values.begin()) EXPECT_EQ(*--it, --expected);
+  EXPECT_EQ(expected, 0);
+}
+
+TEST(set, EndSurvivesCopiesAndClear) {
+  s21::set<std::string> first{"b", "a", "c"};
+  s21::set<std::string> second;
+  second = first;
+  EXPECT_EQ(*--second.end(), "c");
+  s21::set<std::string> third{std::move(second)};
+  EXPECT_EQ(*--third.end(), "c");
+  EXPECT_TRUE(second.begin() == second.end());
+  third.swap(second);
+  EXPECT_EQ(*second.begin(), "a");
+  auto end = first.end();
+  first.clear();
+  EXPECT_TRUE(first.begin() == end);
+  EXPECT_TRUE(--first.end() == end);
+  first.insert("d");
+  EXPECT_EQ(*--end, "d");
+}
+
 TEST(set, MergeTest) {
   SetTest tmp;
   tmp.set_int.merge(tmp.merged);
@@ -1012,8 +1298,8 @@ class MapTest {
 
 TEST(map, Constructor) {
   MapTest tmp;
-  EXPECT_EQ(*(tmp.empty_map.begin()) == *(tmp.empty_map_orig.begin()), true);
-  EXPECT_EQ(*(tmp.empty_map.end()) == *(tmp.empty_map_orig.end()), true);
+  EXPECT_TRUE(tmp.empty_map.begin() == tmp.empty_map.end());
+  EXPECT_TRUE(tmp.empty_map.empty());
 }
 
 TEST(map, ConstructorList) {
@@ -1084,6 +1370,20 @@ TEST(map, EraseTest) {
   EXPECT_THROW(tmp.map_int.at(1), std::out_of_range);
 }
 
+TEST(map, EraseKeyAndRange) {
+  s21::map<int, std::string> tree;
+  for (int i = 0; i < 100; ++i) tree.insert(i, std::to_string(i));
+  EXPECT_EQ(tree.erase(50), 1U);
+  EXPECT_EQ(tree.erase(50), 0U);
+  auto it = tree.erase(tree.find(49));
+  EXPECT_EQ((*it).first, 51);
+  it = tree.erase(tree.begin(), tree.lower_bound(30));
+  EXPECT_EQ((*it).second, "30");
+  EXPECT_EQ(tree.size(), 68U);
+  EXPECT_EQ((*tree.begin()).first, 30);
+  EXPECT_FALSE(tree.contains(29));
+}
+
 TEST(map, InsertTest) {
   MapTest tmp;
   auto s21_pair = tmp.empty_map.insert({1, 2});
@@ -1117,6 +1417,251 @@ TEST(map, ContainsTest) {
   }
 }
 
+TEST(map, FindTest) {
+  MapTest tmp;
+  EXPECT_EQ((*tmp.map_string.find("obon")).second, "katsurage");
+  EXPECT_TRUE(tmp.map_string.find("nani") == tmp.map_string.end());
+  EXPECT_TRUE(tmp.empty_map.find(1) == tmp.empty_map.end());
+}
+
+TEST(map, NegativeValues) {
+  s21::map<int, int> negative{{1, -1}, {2, -2}};
+  EXPECT_TRUE(negative.contains(1));
+  EXPECT_EQ(negative.at(2), -2);
+  EXPECT_FALSE(negative.insert(1, 5).second);
+  EXPECT_EQ(negative[1], -1);
+}
+
+TEST(map, FindBatch) {
+  s21::map<std::string, int> words{{"ab", 1}, {"cd", 2}, {"ef", 3}};
+  std::vector<std::string> keys{"cd", "zz", "ab", "", "ef", "cd"};
+  std::vector<s21::map<std::string, int>::iterator> found;
+  words.find_batch(keys, std::back_inserter(found));
+  std::vector<int> expected{2, 0, 1, 0, 3, 2};
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (expected[i])
+      EXPECT_EQ((*found[i]).second, expected[i]);
+    else
+      EXPECT_TRUE(found[i] == words.end());
+  }
+  bool present[6];
+  words.contains_batch(keys, present);
+  EXPECT_TRUE(present[0] && !present[1] && present[2] && !present[3]);
+}
+
+TEST(map, BloomFilter) {
+  s21::map<std::string, int, s21::BloomFilter<std::string>> words;
+  for (int i = 0; i < 300; ++i) words[std::to_string(i)] = i;
+  words.insert("x", 1);
+  words.insert_or_assign("y", 2);
+  for (int i = 0; i < 600; ++i)
+    EXPECT_EQ(words.contains(std::to_string(i)), i < 300);
+  EXPECT_TRUE(words.contains("x") && words.find("y") != words.end());
+  EXPECT_TRUE(words.find("z") == words.end());
+  s21::map<std::string, int, s21::BloomFilter<std::string>> copy{words};
+  words.erase("x");
+  EXPECT_TRUE(copy.contains("x") && !words.contains("x"));
+  EXPECT_GT(copy.filter().memory_usage(), 0U);
+}
+
+TEST(map, SplitCoversInOrder) {
+  s21::map<int, int> squares;
+  for (int i = 0; i < 1000; ++i) squares.insert(i, i * i);
+  std::vector<s21::map<int, int>::iterator> bounds;
+  squares.split(16, std::back_inserter(bounds));
+  EXPECT_GE(bounds.size(), 17U);
+  EXPECT_TRUE(bounds.front() == squares.begin());
+  EXPECT_TRUE(bounds.back() == squares.end());
+  int expected = 0;
+  for (size_t i = 0; i + 1 < bounds.size(); ++i)
+    for (auto it = bounds[i]; it != bounds[i + 1]; ++it)
+      EXPECT_EQ((*it).first, expected++);
+  EXPECT_EQ(expected, 1000);
+  s21::map<int, int> empty;
+  bounds.clear();
+  empty.split(4, std::back_inserter(bounds));
+  EXPECT_TRUE(bounds.front() == bounds.back());
+}
+
+TEST(map, Parallel) {
+  s21::map<int, int> squares;
+  for (int i = 1; i <= 10000; ++i) squares.insert(i, 0);
+  s21::parallel_for_each(
+      squares, [](std::pair<const int, int> &p) { p.second = p.first * 2; },
+      4);
+  long long sum = s21::parallel_reduce(
+      squares, 0LL,
+      [](long long acc, const std::pair<const int, int> &p) {
+        return acc + p.second;
+      },
+      [](long long a, long long b) { return a + b; }, 4);
+  EXPECT_EQ(sum, 10000LL * 10001);
+  std::string keys = s21::parallel_reduce(
+      squares, std::string{},
+      [](std::string acc, const std::pair<const int, int> &p) {
+        return p.first <= 12 ? acc + std::to_string(p.first % 10) : acc;
+      },
+      [](std::string a, const std::string &b) { return a + b; }, 3);
+  EXPECT_EQ(keys, "123456789012");
+  s21::set<int> odd{1, 3, 5, 7};
+  EXPECT_EQ(s21::parallel_reduce(odd, 0, std::plus<int>{}), 16);
+  struct SumValues {
+    long operator()(long acc, const std::pair<const int, int> &p) const {
+      return acc + p.second;
+    }
+    long operator()(long a, long b) const { return a + b; }
+  };
+  EXPECT_EQ(s21::parallel_reduce(squares, 0L, SumValues{}), 10000L * 10001);
+  auto has_key = [](int key) {
+    return [key](bool found, const std::pair<const int, int> &p) {
+      return found || p.first == key;
+    };
+  };
+  EXPECT_TRUE(s21::parallel_reduce(squares, false, has_key(9999),
+                                   std::logical_or<>{}, 4));
+  EXPECT_FALSE(s21::parallel_reduce(squares, false, has_key(0),
+                                    std::logical_or<>{}, 4));
+  auto reject_five = [](int key) {
+    if (key == 5) throw key;
+  };
+  EXPECT_THROW(s21::parallel_for_each(odd, reject_five, 2), int);
+}
+
+TEST(map, TryEmplaceAndMoves) {
+  s21::map<int, std::vector<int>> buffers;
+  std::vector<int> big(1000, 7);
+  const int *data = big.data();
+  auto result = buffers.try_emplace(1, std::move(big));
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).second.data(), data);
+  std::vector<int> kept(10, 1);
+  EXPECT_FALSE(buffers.try_emplace(1, std::move(kept)).second);
+  EXPECT_EQ(kept.size(), 10U);
+  EXPECT_FALSE(buffers.insert(1, std::move(kept)).second);
+  EXPECT_EQ(kept.size(), 10U);
+  EXPECT_TRUE(buffers.try_emplace(2, 5, 3).second);
+  EXPECT_EQ(buffers[2], std::vector<int>(5, 3));
+  EXPECT_TRUE(buffers.emplace(3, std::vector<int>{4}).second);
+  EXPECT_FALSE(buffers.emplace(std::make_pair(3, kept)).second);
+  data = kept.data();
+  EXPECT_TRUE(buffers.insert_or_assign(4, std::move(kept)).second);
+  EXPECT_EQ(buffers.at(4).data(), data);
+  std::vector<int> other(3, 9);
+  data = other.data();
+  EXPECT_FALSE(buffers.insert_or_assign(4, std::move(other)).second);
+  EXPECT_EQ(buffers.at(4).data(), data);
+  std::pair<const int, std::vector<int>> pair{5, std::vector<int>(2)};
+  EXPECT_TRUE(buffers.insert(std::move(pair)).second);
+  EXPECT_TRUE(buffers[6].empty());
+  EXPECT_EQ(buffers.size(), 6U);
+  s21::map<std::string, std::vector<int>> named;
+  std::string name(64, 'k');
+  const char *name_data = name.data();
+  const std::vector<int> shared(4, 1);
+  EXPECT_TRUE(named.insert_or_assign(std::move(name), shared).second);
+  EXPECT_EQ((*named.begin()).first.data(), name_data);
+  EXPECT_EQ((*named.begin()).second, shared);
+}
+
+TEST(map, ExtractAndReinsert) {
+  s21::map<std::string, std::vector<int>> from{{"a", {1}}, {"b", {2, 2}}};
+  s21::map<std::string, std::vector<int>> to{{"b", {3}}};
+  const int *data = from.at("a").data();
+  auto node = from.extract("a");
+  ASSERT_FALSE(node.empty());
+  EXPECT_FALSE(from.contains("a"));
+  EXPECT_EQ(from.size(), 1U);
+  EXPECT_EQ(node.key(), "a");
+  auto inserted = to.insert(std::move(node));
+  EXPECT_TRUE(inserted.inserted && inserted.node.empty());
+  EXPECT_EQ((*inserted.position).first, "a");
+  EXPECT_EQ(to.at("a").data(), data);
+  auto taken = from.extract(from.begin());
+  auto blocked = to.insert(std::move(taken));
+  EXPECT_FALSE(blocked.inserted);
+  EXPECT_EQ((*blocked.position).second, std::vector<int>{3});
+  EXPECT_EQ(blocked.node.mapped(), (std::vector<int>{2, 2}));
+  EXPECT_TRUE(from.empty());
+  EXPECT_TRUE(from.extract("zz").empty());
+  EXPECT_FALSE(to.insert(s21::map<std::string, std::vector<int>>::node_type{})
+                   .inserted);
+}
+
+TEST(map, DumpSortedAndMappedTable) {
+  struct Record {
+    std::uint64_t id;
+    double score;
+  };
+  std::string path = testing::TempDir() + "s21_map_table.bin";
+  s21::map<std::uint64_t, Record> records;
+  for (std::uint64_t i = 0; i < 1000; ++i)
+    records.insert((i * 7919) % 1000 * 3, Record{i, i * 0.5});
+  records.dump_sorted(path);
+  s21::mapped_table<std::uint64_t, Record> table{path};
+  EXPECT_EQ(table.size(), 1000U);
+  auto it = table.begin();
+  for (auto node = records.begin(); node != records.end(); ++node, ++it) {
+    EXPECT_EQ(it.key(), (*node).first);
+    EXPECT_EQ((*it).second.id, (*node).second.id);
+  }
+  EXPECT_TRUE(it == table.end());
+  for (std::uint64_t key = 0; key < 3005; ++key) {
+    EXPECT_EQ(table.contains(key), key % 3 == 0 && key < 3000);
+    auto lower = table.lower_bound(key);
+    auto upper = table.upper_bound(key);
+    if (key < 2998) {
+      EXPECT_EQ(lower.key(), (key + 2) / 3 * 3);
+    } else {
+      EXPECT_TRUE(lower == table.end());
+    }
+    if (key < 2997) {
+      EXPECT_EQ(upper.key(), key / 3 * 3 + 3);
+    } else {
+      EXPECT_TRUE(upper == table.end());
+    }
+  }
+  EXPECT_EQ(table.at(2997).score, records.at(2997).score);
+  EXPECT_THROW(table.at(1), std::out_of_range);
+  s21::mapped_table<std::uint64_t, Record> moved{std::move(table)};
+  EXPECT_TRUE(table.empty() && moved.contains(0));
+  auto open_error = [](const std::string &file) -> std::string {
+    try {
+      s21::mapped_table<std::uint64_t, int> opened{file};
+    } catch (const std::system_error &) {
+      return "system_error";
+    } catch (const std::runtime_error &) {
+      return "runtime_error";
+    }
+    return "none";
+  };
+  EXPECT_EQ(open_error(path), "runtime_error");
+  EXPECT_EQ(open_error(path + ".none"), "system_error");
+  std::string truncated = path + ".short";
+  std::ofstream{truncated, std::ios::binary} << "S21";
+  EXPECT_EQ(open_error(truncated), "runtime_error");
+  std::remove(truncated.c_str());
+  s21::map<std::uint64_t, Record>{}.dump_sorted(path);
+  s21::mapped_table<std::uint64_t, Record> empty{path};
+  EXPECT_TRUE(empty.empty() && empty.find(3) == empty.end());
+  std::remove(path.c_str());
+}
+
+TEST(map, RangeTest) {
+  MapTest tmp;
+  EXPECT_EQ((*tmp.map_int.lower_bound(3)).first, 3);
+  EXPECT_EQ((*tmp.map_int.upper_bound(3)).first, 4);
+  EXPECT_TRUE(tmp.map_int.lower_bound(9) == tmp.map_int.end());
+  auto range = tmp.map_int.equal_range(5);
+  EXPECT_EQ((*range.first).second, 6);
+  EXPECT_TRUE(++range.first == range.second);
+  tmp.map_int.for_each_in_range(2, 5, [](std::pair<const int, int> &item) {
+    item.second = -item.first;
+  });
+  EXPECT_EQ(tmp.map_int.at(1), 2);
+  EXPECT_EQ(tmp.map_int.at(4), -4);
+  EXPECT_EQ(tmp.map_int.at(5), 6);
+}
+
 TEST(map, MergeTest) {
   MapTest tmp;
   tmp.map_int.merge(tmp.merged);
@@ -1129,6 +1674,722 @@ TEST(map, MergeTest) {
   }
 }
 
+/* ------------------------- BTREE SET --------------------------- */
+
+class BTreeSetTest {
+ public:
+  s21::btree_set<int> empty_set;
+  s21::btree_set<int> set_int{3, 5, 7, 2, 1, 1, 4, 6};
+  s21::btree_set<std::string> set_string{"baka", "obon", "kokoro"};
+
+  std::set<int> empty_set_orig;
+  std::set<int> set_int_orig{3, 5, 7, 2, 1, 1, 4, 6};
+  std::set<std::string> set_string_orig{"baka", "obon", "kokoro"};
+
+  s21::btree_set<int> merged{1, 50, 60};
+  std::set<int> merged_orig{1, 50, 60};
+};
+
+TEST(btree_set, ConstructorList) {
+  BTreeSetTest tmp;
+  EXPECT_EQ(tmp.set_int.size(), tmp.set_int_orig.size());
+  auto it_orig = tmp.set_int_orig.begin();
+  for (auto it : tmp.set_int) EXPECT_EQ(it, *(it_orig++));
+  EXPECT_TRUE(tmp.empty_set.begin() == tmp.empty_set.end());
+}
+
+TEST(btree_set, ConstructorCopyMove) {
+  BTreeSetTest tmp;
+  s21::btree_set<std::string> copy{tmp.set_string};
+  s21::btree_set<std::string> moved{std::move(tmp.set_string)};
+  EXPECT_TRUE(tmp.set_string.empty());
+  EXPECT_EQ(copy.size(), tmp.set_string_orig.size());
+  EXPECT_EQ(moved.size(), tmp.set_string_orig.size());
+  auto it_copy = copy.begin();
+  auto it_moved = moved.begin();
+  for (auto it : tmp.set_string_orig) {
+    EXPECT_EQ(*(it_copy++), it);
+    EXPECT_EQ(*(it_moved++), it);
+  }
+}
+
+TEST(btree_set, InsertFind) {
+  s21::btree_set<int> tree;
+  for (int i = 0; i < 10000; ++i) {
+    auto res = tree.insert((i * 7919) % 10000);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(*res.first, (i * 7919) % 10000);
+  }
+  EXPECT_FALSE(tree.insert(42).second);
+  EXPECT_EQ(tree.size(), 10000U);
+  for (int i = 0; i < 10000; ++i) EXPECT_EQ(*tree.find(i), i);
+  EXPECT_TRUE(tree.find(10000) == tree.end());
+  EXPECT_FALSE(tree.contains(-1));
+}
+
+TEST(btree_set, Iterators) {
+  s21::btree_set<std::string> tree;
+  std::set<std::string> orig;
+  for (int i = 0; i < 2000; ++i) {
+    tree.insert(std::to_string(i));
+    orig.insert(std::to_string(i));
+  }
+  auto it_orig = orig.begin();
+  for (auto it = tree.begin(); it != tree.end(); ++it)
+    EXPECT_EQ(*it, *(it_orig++));
+  auto rit_orig = orig.rbegin();
+  auto it = tree.end();
+  do {
+    --it;
+    EXPECT_EQ(*it, *(rit_orig++));
+  } while (it != tree.begin());
+}
+
+TEST(btree_set, EraseTest) {
+  s21::btree_set<int> tree;
+  std::set<int> orig;
+  unsigned seed = 17;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int value = static_cast<int>(seed % 5000);
+    if (seed & 0x10000) {
+      tree.insert(value);
+      orig.insert(value);
+    } else if (tree.contains(value)) {
+      tree.erase(tree.find(value));
+      orig.erase(value);
+    }
+  }
+  EXPECT_EQ(tree.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : tree) EXPECT_EQ(it, *(it_orig++));
+  while (!tree.empty()) tree.erase(tree.begin());
+  EXPECT_TRUE(tree.begin() == tree.end());
+}
+
+TEST(btree_set, SwapTest) {
+  BTreeSetTest tmp;
+  tmp.set_int.swap(tmp.merged);
+  EXPECT_EQ(tmp.set_int.size(), tmp.merged_orig.size());
+  EXPECT_EQ(tmp.merged.size(), tmp.set_int_orig.size());
+  EXPECT_TRUE(tmp.set_int.contains(60));
+  EXPECT_TRUE(tmp.merged.contains(7));
+}
+
+TEST(btree_set, MergeTest) {
+  BTreeSetTest tmp;
+  tmp.set_int.merge(tmp.merged);
+  tmp.set_int_orig.merge(tmp.merged_orig);
+  EXPECT_EQ(tmp.set_int.size(), tmp.set_int_orig.size());
+  EXPECT_EQ(tmp.merged.size(), tmp.merged_orig.size());
+  auto it_orig = tmp.set_int_orig.begin();
+  for (auto it : tmp.set_int) EXPECT_EQ(it, *(it_orig++));
+  EXPECT_TRUE(tmp.merged.contains(1));
+}
+
+/* ------------------------- BTREE MAP --------------------------- */
+
+TEST(btree_map, ConstructorList) {
+  s21::btree_map<int, int> tree{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  std::map<int, int> orig{{3, 30}, {1, 10}, {2, 20}, {1, 100}};
+  EXPECT_EQ(tree.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : tree) EXPECT_TRUE(it == *(it_orig++));
+}
+
+TEST(btree_map, AtAndBrackets) {
+  s21::btree_map<std::string, int> tree{{"baka", -1}, {"obon", 2}};
+  EXPECT_EQ(tree.at("baka"), -1);
+  EXPECT_THROW(tree.at("kokoro"), std::out_of_range);
+  tree["kokoro"] = 5;
+  EXPECT_EQ(tree.at("kokoro"), 5);
+  EXPECT_EQ(tree["missing"], 0);
+  EXPECT_EQ(tree.size(), 4U);
+}
+
+TEST(btree_map, InsertTest) {
+  s21::btree_map<int, int> tree;
+  EXPECT_TRUE(tree.insert({1, 2}).second);
+  EXPECT_FALSE(tree.insert(1, 3).second);
+  EXPECT_EQ(tree[1], 2);
+  auto res = tree.insert_or_assign(1, 10);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ((*res.first).second, 10);
+  EXPECT_TRUE(tree.insert_or_assign(5, -5).second);
+  EXPECT_EQ(tree.at(5), -5);
+}
+
+TEST(btree_map, EraseTest) {
+  s21::btree_map<int, int> tree;
+  std::map<int, int> orig;
+  for (int i = 0; i < 5000; ++i) {
+    tree.insert(i, -i);
+    orig.insert({i, -i});
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    tree.erase(tree.find(i));
+    orig.erase(i);
+  }
+  EXPECT_EQ(tree.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : tree) EXPECT_TRUE(it == *(it_orig++));
+}
+
+TEST(btree_map, MergeTest) {
+  s21::btree_map<int, int> tree{{1, 2}, {2, 3}, {3, 4}};
+  s21::btree_map<int, int> other{{1, 1}, {50, 2}, {60, 3}};
+  tree.merge(other);
+  EXPECT_EQ(tree.size(), 5U);
+  EXPECT_EQ(tree.at(1), 2);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(1), 1);
+}
+
+/* ------------------------- FLAT SET ---------------------------- */
+
+TEST(flat_set, ConstructorList) {
+  s21::flat_set<int> flat{3, 5, 7, 2, 1, 1, 4, 6};
+  std::set<int> orig{3, 5, 7, 2, 1, 1, 4, 6};
+  EXPECT_EQ(flat.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : flat) EXPECT_EQ(it, *(it_orig++));
+  s21::flat_set<int> empty;
+  EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(flat_set, ConstructorFromSet) {
+  s21::set<std::string> tree{"baka", "obon", "kokoro"};
+  s21::flat_set<std::string> flat{tree};
+  EXPECT_EQ(flat.size(), tree.size());
+  auto it_tree = tree.begin();
+  for (auto it : flat) EXPECT_EQ(it, *(it_tree++));
+}
+
+TEST(flat_set, InsertFindErase) {
+  s21::flat_set<int> flat;
+  std::set<int> orig;
+  for (int i = 0; i < 1000; ++i) {
+    auto res = flat.insert((i * 7919) % 1000);
+    orig.insert((i * 7919) % 1000);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(*res.first, (i * 7919) % 1000);
+  }
+  EXPECT_FALSE(flat.insert(5).second);
+  for (int i = 0; i < 1000; i += 3) {
+    flat.erase(flat.find(i));
+    orig.erase(i);
+  }
+  EXPECT_EQ(flat.size(), orig.size());
+  EXPECT_TRUE(flat.find(3) == flat.end());
+  EXPECT_TRUE(flat.contains(4));
+  EXPECT_EQ(*flat.lower_bound(3), 4);
+  auto it_orig = orig.begin();
+  for (auto it : flat) EXPECT_EQ(it, *(it_orig++));
+}
+
+TEST(flat_set, BulkInsert) {
+  s21::flat_set<int> flat{10, 20, 30};
+  std::vector<int> items{25, 5, 20, 35, 5, 15};
+  flat.insert(items.begin(), items.end());
+  std::set<int> orig{5, 10, 15, 20, 25, 30, 35};
+  EXPECT_EQ(flat.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto it : flat) EXPECT_EQ(it, *(it_orig++));
+}
+
+TEST(flat_set, MergeSwap) {
+  s21::flat_set<int> flat{1, 2, 3};
+  s21::flat_set<int> other{1, 50, 60};
+  flat.merge(other);
+  EXPECT_EQ(flat.size(), 5U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(1));
+  flat.swap(other);
+  EXPECT_EQ(flat.size(), 1U);
+  EXPECT_TRUE(other.contains(60));
+}
+
+/* ------------------------- FLAT MAP ---------------------------- */
+
+TEST(flat_map, ConstructorFromMap) {
+  s21::map<int, int> tree{{3, -3}, {1, -1}, {2, -2}};
+  s21::flat_map<int, int> flat{tree};
+  EXPECT_EQ(flat.size(), 3U);
+  int key = 1;
+  for (auto it : flat) {
+    EXPECT_EQ(it.first, key);
+    EXPECT_EQ(it.second, -key++);
+  }
+}
+
+TEST(flat_map, AtAndBrackets) {
+  s21::flat_map<std::string, int> flat{{"baka", -1}, {"obon", 2}};
+  EXPECT_EQ(flat.at("baka"), -1);
+  EXPECT_THROW(flat.at("kokoro"), std::out_of_range);
+  flat["kokoro"] = 5;
+  EXPECT_EQ(flat.at("kokoro"), 5);
+  EXPECT_EQ(flat["missing"], 0);
+  EXPECT_EQ(flat.size(), 4U);
+}
+
+TEST(flat_map, InsertErase) {
+  s21::flat_map<int, int> flat;
+  EXPECT_TRUE(flat.insert({2, 2}).second);
+  EXPECT_TRUE(flat.insert(1, 1).second);
+  EXPECT_FALSE(flat.insert(1, 3).second);
+  EXPECT_FALSE(flat.insert_or_assign(1, 10).second);
+  EXPECT_EQ(flat.at(1), 10);
+  std::vector<std::pair<int, int>> items{{5, 5}, {2, 20}, {4, 4}, {4, 40}};
+  flat.insert(items.begin(), items.end());
+  EXPECT_EQ(flat.size(), 4U);
+  EXPECT_EQ(flat.at(2), 2);
+  EXPECT_EQ(flat.at(4), 4);
+  flat.erase(flat.find(2));
+  EXPECT_FALSE(flat.contains(2));
+  EXPECT_EQ((*flat.lower_bound(2)).first, 4);
+}
+
+TEST(flat_map, MergeTest) {
+  s21::flat_map<int, int> flat{{1, 2}, {2, 3}, {3, 4}};
+  s21::flat_map<int, int> other{{1, 1}, {50, 2}, {60, 3}};
+  flat.merge(other);
+  EXPECT_EQ(flat.size(), 5U);
+  EXPECT_EQ(flat.at(1), 2);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(1), 1);
+}
+
+/* ---------------------- UNORDERED SET -------------------------- */
+
+struct TransparentStringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>{}(str);
+  }
+};
+
+TEST(unordered_set, InsertFindErase) {
+  s21::unordered_set<int> hash;
+  std::set<int> orig;
+  for (int i = 0; i < 5000; ++i) {
+    auto res = hash.insert((i * 7919) % 5000);
+    orig.insert((i * 7919) % 5000);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(*res.first, (i * 7919) % 5000);
+  }
+  EXPECT_FALSE(hash.insert(5).second);
+  for (int i = 0; i < 5000; i += 3) {
+    EXPECT_EQ(hash.erase(i), 1U);
+    orig.erase(i);
+  }
+  EXPECT_EQ(hash.erase(3), 0U);
+  EXPECT_EQ(hash.size(), orig.size());
+  EXPECT_TRUE(hash.find(3) == hash.end());
+  EXPECT_EQ(hash.count(4), 1U);
+  for (int i = 0; i < 5000; ++i) EXPECT_EQ(hash.contains(i), orig.count(i));
+  std::set<int> iterated;
+  for (auto it : hash) iterated.insert(it);
+  EXPECT_EQ(iterated, orig);
+}
+
+TEST(unordered_set, EraseInsertChurn) {
+  s21::unordered_set<int> hash;
+  hash.reserve(100);
+  size_t buckets = hash.bucket_count();
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 100; ++i) hash.insert(round * 100 + i);
+    for (int i = 0; i < 100; ++i) hash.erase(hash.find(round * 100 + i));
+  }
+  EXPECT_TRUE(hash.empty());
+  EXPECT_EQ(hash.bucket_count(), buckets);
+  EXPECT_TRUE(hash.begin() == hash.end());
+}
+
+TEST(unordered_set, HashPolicy) {
+  s21::unordered_set<int> hash{1, 2, 3};
+  EXPECT_LE(hash.load_factor(), hash.max_load_factor());
+  hash.reserve(1000);
+  size_t buckets = hash.bucket_count();
+  EXPECT_GE(buckets * hash.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) hash.insert(i);
+  EXPECT_EQ(hash.bucket_count(), buckets);
+  hash.max_load_factor(0.25f);
+  EXPECT_LE(hash.load_factor(), 0.25f);
+  EXPECT_THROW(hash.max_load_factor(0.0f), std::invalid_argument);
+  hash.clear();
+  hash.rehash(0);
+  EXPECT_EQ(hash.bucket_count(), 0U);
+  EXPECT_FALSE(hash.contains(1));
+}
+
+TEST(unordered_set, CopyMergeSwap) {
+  s21::unordered_set<std::string> hash{"baka", "obon", "kokoro"};
+  s21::unordered_set<std::string> copy{hash};
+  hash.erase("obon");
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_TRUE(copy.contains("obon"));
+  s21::unordered_set<std::string> other{"baka", "nani"};
+  hash.merge(other);
+  EXPECT_EQ(hash.size(), 3U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains("baka"));
+  hash.swap(other);
+  EXPECT_EQ(hash.size(), 1U);
+  EXPECT_TRUE(other.contains("nani"));
+}
+
+TEST(unordered_set, HeterogeneousLookup) {
+  s21::unordered_set<std::string, TransparentStringHash, std::equal_to<>>
+      hash{"baka", "obon"};
+  std::string_view key{"obon"};
+  EXPECT_TRUE(hash.contains(key));
+  EXPECT_EQ(hash.count("baka"), 1U);
+  EXPECT_EQ(*hash.find(key), "obon");
+  EXPECT_FALSE(hash.contains(std::string_view{"kokoro"}));
+}
+
+/* ---------------------- UNORDERED MAP -------------------------- */
+
+TEST(unordered_map, AtAndBrackets) {
+  s21::unordered_map<std::string, int> hash{{"baka", -1}, {"obon", 2}};
+  EXPECT_EQ(hash.at("baka"), -1);
+  EXPECT_THROW(hash.at("kokoro"), std::out_of_range);
+  hash["kokoro"] = 5;
+  EXPECT_EQ(hash.at("kokoro"), 5);
+  EXPECT_EQ(hash["missing"], 0);
+  EXPECT_EQ(hash.size(), 4U);
+}
+
+TEST(unordered_map, InsertErase) {
+  s21::unordered_map<int, int> hash;
+  std::map<int, int> orig;
+  EXPECT_TRUE(hash.insert({2, 2}).second);
+  EXPECT_TRUE(hash.insert(1, 1).second);
+  EXPECT_FALSE(hash.insert(1, 3).second);
+  EXPECT_FALSE(hash.insert_or_assign(1, 10).second);
+  EXPECT_TRUE(hash.insert_or_assign(3, 30).second);
+  EXPECT_EQ(hash.at(1), 10);
+  for (int i = 0; i < 2000; ++i) hash.insert_or_assign(i, -i);
+  for (int i = 0; i < 2000; i += 2) hash.erase(i);
+  for (int i = 1; i < 2000; i += 2) orig[i] = -i;
+  EXPECT_EQ(hash.size(), orig.size());
+  for (auto it : hash) EXPECT_EQ(orig.at(it.first), it.second);
+}
+
+TEST(unordered_map, MergeTest) {
+  s21::unordered_map<int, int> hash{{1, 2}, {2, 3}, {3, 4}};
+  s21::unordered_map<int, int> other{{1, 1}, {50, 2}, {60, 3}};
+  hash.merge(other);
+  EXPECT_EQ(hash.size(), 5U);
+  EXPECT_EQ(hash.at(1), 2);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(1), 1);
+}
+
+TEST(unordered_map, HeterogeneousLookup) {
+  s21::unordered_map<std::string, int, TransparentStringHash,
+                     std::equal_to<>>
+      hash{{"baka", 1}, {"obon", 2}};
+  EXPECT_EQ((*hash.find(std::string_view{"obon"})).second, 2);
+  EXPECT_TRUE(hash.contains(std::string_view{"baka"}));
+  EXPECT_EQ(hash.count(std::string_view{"kokoro"}), 0U);
+}
+
+/* ---------------------- CONCURRENT MAP ------------------------- */
+
+TEST(concurrent_map, SingleThread) {
+  s21::concurrent_map<std::string, int> conc{{"baka", 1}, {"obon", 2}};
+  EXPECT_EQ(conc.size(), 2U);
+  EXPECT_EQ(conc.find("baka"), 1);
+  EXPECT_FALSE(conc.find("kokoro").has_value());
+  EXPECT_FALSE(conc.insert("baka", 10));
+  EXPECT_FALSE(conc.insert_or_assign("baka", 10));
+  EXPECT_EQ(conc.find("baka"), 10);
+  EXPECT_TRUE(conc.update("obon", [](int &value) { value *= 3; }));
+  EXPECT_FALSE(conc.update("kokoro", [](int &value) { value = 0; }));
+  EXPECT_EQ(conc.find("obon"), 6);
+  EXPECT_EQ(conc.erase("obon"), 1U);
+  EXPECT_EQ(conc.erase("obon"), 0U);
+  EXPECT_FALSE(conc.contains("obon"));
+  conc.clear();
+  EXPECT_TRUE(conc.empty());
+}
+
+TEST(concurrent_map, ParallelWriters) {
+  s21::concurrent_map<int, int> conc;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&conc, t] {
+      for (int i = 0; i < 1000; ++i) {
+        conc.insert_or_assign(t * 1000 + i, i);
+        conc.insert(-1 - i % 100, 0);
+        conc.update(-1 - i % 100, [](int &value) { ++value; });
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(conc.size(), 4100U);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(conc.find(-1 - i), 40);
+}
+
+TEST(concurrent_map, VisitWhileWriting) {
+  s21::concurrent_map<int, int, std::hash<int>, 8> conc;
+  for (int i = 0; i < 1000; ++i) conc.insert(i, i);
+  std::thread writer{[&conc] {
+    for (int i = 1000; i < 2000; ++i) conc.insert(i, i);
+  }};
+  size_t visited{};
+  conc.visit([&visited](const std::pair<const int, int> &item) {
+    EXPECT_EQ(item.first, item.second);
+    ++visited;
+  });
+  writer.join();
+  EXPECT_GE(visited, 1000U);
+  EXPECT_LE(visited, 2000U);
+  EXPECT_EQ(conc.size(), 2000U);
+}
+
+/* ---------------------- PERSISTENT SET ------------------------- */
+
+TEST(persistent_set, InsertFindErase) {
+  s21::persistent_set<int> pers;
+  std::set<int> orig;
+  for (int i = 0; i < 1000; ++i) {
+    auto res = pers.insert((i * 7919) % 1000);
+    orig.insert((i * 7919) % 1000);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(*res.first, (i * 7919) % 1000);
+  }
+  EXPECT_FALSE(pers.insert(5).second);
+  for (int i = 0; i < 1000; i += 3) {
+    EXPECT_EQ(pers.erase(i), 1U);
+    orig.erase(i);
+  }
+  EXPECT_EQ(pers.erase(3), 0U);
+  pers.erase(pers.find(4));
+  orig.erase(4);
+  EXPECT_EQ(pers.size(), orig.size());
+  EXPECT_TRUE(pers.find(3) == pers.end());
+  EXPECT_EQ(*pers.find(5), 5);
+  EXPECT_EQ(*++pers.find(5), 7);
+  auto it_orig = orig.begin();
+  for (auto it : pers) EXPECT_EQ(it, *(it_orig++));
+}
+
+TEST(persistent_set, CopiesAreSnapshots) {
+  s21::persistent_set<std::string> first{"baka", "obon", "kokoro"};
+  s21::persistent_set<std::string> second{first};
+  second.insert("nani");
+  second.erase("baka");
+  s21::persistent_set<std::string> third;
+  third = second;
+  first.clear();
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.size(), 3U);
+  EXPECT_FALSE(second.contains("baka"));
+  EXPECT_TRUE(third.contains("nani"));
+  third.swap(first);
+  EXPECT_TRUE(third.empty());
+  EXPECT_EQ(first.size(), 3U);
+}
+
+/* ---------------------- PERSISTENT MAP ------------------------- */
+
+TEST(persistent_map, Versions) {
+  s21::persistent_map<int, int> base;
+  for (int i = 0; i < 100; ++i) base.insert(i, i);
+  s21::persistent_map<int, int> next{base};
+  EXPECT_FALSE(next.insert_or_assign(10, -10).second);
+  EXPECT_TRUE(next.insert_or_assign(200, 200).second);
+  EXPECT_FALSE(next.insert(11, 0).second);
+  next.erase(next.find(20));
+  EXPECT_EQ(next.erase(30), 1U);
+  EXPECT_EQ(base.size(), 100U);
+  EXPECT_EQ(next.size(), 99U);
+  EXPECT_EQ(base.at(10), 10);
+  EXPECT_EQ(next.at(10), -10);
+  EXPECT_TRUE(base.contains(20));
+  EXPECT_FALSE(next.contains(30));
+  EXPECT_THROW(base.at(200), std::out_of_range);
+  int key = 0;
+  for (auto it : base) EXPECT_EQ(it.first, key++);
+}
+
+TEST(persistent_map, ReleaseInAnyOrder) {
+  std::vector<s21::persistent_map<int, std::string>> versions(1);
+  for (int i = 0; i < 50; ++i) {
+    versions.push_back(versions.back());
+    versions.back().insert_or_assign(i % 10, std::to_string(i));
+    if (i % 7 == 0) versions.back().erase(i % 5);
+  }
+  for (size_t i = 0; i < versions.size(); i += 2) versions[i].clear();
+  EXPECT_EQ(versions[3].at(2), "2");
+  EXPECT_FALSE(versions[3].contains(0));
+  EXPECT_EQ(versions[49].at(9), "39");
+  EXPECT_EQ(versions[49].at(4), "44");
+  EXPECT_EQ(versions[49].size(), 9U);
+}
+
+/* ------------------------ MULTISET ----------------------------- */
+
+TEST(multiset, Duplicates) {
+  s21::multiset<int> ms{5, 1, 5, 3, 5, 1};
+  std::multiset<int> orig{5, 1, 5, 3, 5, 1};
+  EXPECT_EQ(ms.size(), 6U);
+  EXPECT_EQ(ms.count(5), 3U);
+  EXPECT_EQ(ms.count(2), 0U);
+  EXPECT_TRUE(ms.contains(3));
+  EXPECT_EQ(*ms.insert(3), 3);
+  orig.insert(3);
+  auto it_orig = orig.begin();
+  for (auto it : ms) EXPECT_EQ(it, *(it_orig++));
+  auto range = ms.equal_range(5);
+  int found = 0;
+  for (auto it = range.first; it != range.second; ++it) ++found;
+  EXPECT_EQ(found, 3);
+  EXPECT_TRUE(ms.equal_range(4).first == ms.equal_range(4).second);
+}
+
+TEST(multiset, EraseKeyAndPosition) {
+  s21::multiset<int> ms;
+  std::multiset<int> orig;
+  for (int i = 0; i < 500; ++i) {
+    ms.insert(i % 37);
+    orig.insert(i % 37);
+  }
+  for (int key = 0; key < 37; key += 3)
+    EXPECT_EQ(ms.erase(key), orig.erase(key));
+  EXPECT_EQ(ms.erase(1000), 0U);
+  auto it = ms.find(10);
+  ms.erase(++it);
+  orig.erase(++orig.find(10));
+  EXPECT_EQ(ms.size(), orig.size());
+  auto it_orig = orig.begin();
+  for (auto value : ms) EXPECT_EQ(value, *(it_orig++));
+  for (int key = 0; key < 37; ++key) ms.erase(key);
+  EXPECT_TRUE(ms.empty());
+  EXPECT_TRUE(ms.begin() == ms.end());
+}
+
+TEST(multiset, Merge) {
+  s21::multiset<std::string> first{"a", "b"};
+  s21::multiset<std::string> second{"b", "c", "b"};
+  first.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 5U);
+  EXPECT_EQ(first.count("b"), 3U);
+  s21::multiset<std::string> copy{first};
+  copy.swap(second);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(second.count("b"), 3U);
+}
+
+/* ------------------------ MULTIMAP ----------------------------- */
+
+TEST(multimap, KeepsInsertionOrder) {
+  s21::multimap<int, int> mm{{2, 0}, {1, 0}, {2, 1}};
+  for (int i = 2; i < 100; ++i) mm.insert(2, i);
+  mm.insert(std::pair<const int, int>{3, 0});
+  EXPECT_EQ(mm.size(), 102U);
+  EXPECT_EQ(mm.count(2), 100U);
+  int expected = 0;
+  auto range = mm.equal_range(2);
+  for (auto it = range.first; it != range.second; ++it)
+    EXPECT_EQ((*it).second, expected++);
+  EXPECT_EQ((*mm.find(2)).second, 0);
+  EXPECT_EQ((*mm.upper_bound(2)).first, 3);
+  EXPECT_TRUE(mm.find(4) == mm.end());
+}
+
+TEST(multimap, Erase) {
+  s21::multimap<int, std::string> mm;
+  for (int i = 0; i < 300; ++i) mm.insert(i % 10, std::to_string(i));
+  EXPECT_EQ(mm.erase(0), 30U);
+  EXPECT_EQ(mm.erase(9), 30U);
+  EXPECT_EQ(mm.erase(0), 0U);
+  auto it = mm.lower_bound(5);
+  ++it;
+  mm.erase(it);
+  EXPECT_EQ(mm.count(5), 29U);
+  EXPECT_EQ((*++mm.find(5)).second, "25");
+  EXPECT_EQ(mm.size(), 239U);
+  int prev = 0;
+  for (auto item : mm) {
+    EXPECT_LE(prev, item.first);
+    prev = item.first;
+  }
+  s21::multimap<int, std::string> other{{1, "x"}};
+  other.merge(mm);
+  EXPECT_EQ(other.count(1), 31U);
+  EXPECT_EQ((*other.find(1)).second, "x");
+}
+
+/* ----------------------- FROZEN SET ---------------------------- */
+
+TEST(frozen_set, MatchesSet) {
+  for (int n : {0, 1, 2, 7, 8, 100, 1023, 1024, 1500}) {
+    s21::set<int> source;
+    std::set<int> orig;
+    for (int i = 0; i < n; ++i) {
+      source.insert((i * 7919) % n * 2);
+      orig.insert((i * 7919) % n * 2);
+    }
+    s21::frozen_set<int> frozen{source};
+    EXPECT_EQ(frozen.size(), orig.size());
+    auto it_orig = orig.begin();
+    for (auto value : frozen) EXPECT_EQ(value, *(it_orig++));
+    for (int key = -1; key <= n * 2 + 1; ++key) {
+      EXPECT_EQ(frozen.contains(key), orig.count(key) == 1);
+      auto lower = frozen.lower_bound(key);
+      auto upper = frozen.upper_bound(key);
+      if (orig.lower_bound(key) == orig.end())
+        EXPECT_TRUE(lower == frozen.end());
+      else
+        EXPECT_EQ(*lower, *orig.lower_bound(key));
+      if (orig.upper_bound(key) == orig.end())
+        EXPECT_TRUE(upper == frozen.end());
+      else
+        EXPECT_EQ(*upper, *orig.upper_bound(key));
+    }
+    int expected = n * 2;
+    for (auto it = frozen.end(); it != frozen.begin();)
+      EXPECT_EQ(*--it, expected -= 2);
+  }
+}
+
+TEST(frozen_set, SortedRange) {
+  std::vector<std::string> words{"a", "b", "b", "c", "d", "d", "d"};
+  s21::frozen_set<std::string> frozen{words.begin(), words.end()};
+  EXPECT_EQ(frozen.size(), 4U);
+  EXPECT_EQ(*frozen.find("c"), "c");
+  EXPECT_TRUE(frozen.find("bb") == frozen.end());
+  s21::frozen_set<std::string> copy;
+  copy = frozen;
+  s21::frozen_set<std::string> moved{std::move(frozen)};
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_EQ(*--copy.end(), "d");
+  EXPECT_EQ(*moved.begin(), "a");
+}
+
+/* ----------------------- FROZEN MAP ---------------------------- */
+
+TEST(frozen_map, Lookup) {
+  s21::map<int, std::string> source;
+  for (int i = 0; i < 300; ++i) source.insert(i * 3, std::to_string(i));
+  s21::frozen_map<int, std::string> frozen{source};
+  EXPECT_EQ(frozen.size(), 300U);
+  EXPECT_EQ(frozen.at(30), "10");
+  EXPECT_THROW(frozen.at(31), std::out_of_range);
+  EXPECT_EQ(frozen.lower_bound(31)->first, 33);
+  EXPECT_EQ(frozen.upper_bound(33)->second, "12");
+  EXPECT_FALSE(frozen.contains(-3));
+  int key = 0;
+  for (const auto &item : frozen) {
+    EXPECT_EQ(item.first, key);
+    key += 3;
+  }
+}
+
 /* ------------------------ ARRRAY ----------------------------- */
 
 class s21ArrayTest : public testing::Test {
@@ -1271,6 +2532,164 @@ TEST_F(s21ArrayTest, At) {
                std::out_of_range);
 }
 
+static_assert(std::is_trivially_copyable_v<s21::Array<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<s21::Array<std::string, 2>>);
+
+constexpr s21::Array<uint32_t, 256> make_crc32_table() {
+  s21::Array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < table.size(); ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit)
+      crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr s21::Array<uint32_t, 256> crc32_table = make_crc32_table();
+
+constexpr uint32_t crc32(std::string_view bytes) {
+  uint32_t crc = 0xFFFFFFFFu;
+  for (unsigned char byte : bytes)
+    crc = crc32_table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static_assert(crc32_table[1] == 0x77073096u);
+static_assert(crc32_table.back() == 0x2D02EF8Du);
+static_assert(crc32("123456789") == 0xCBF43926u);
+
+constexpr s21::Array<int, 4> swapped_and_filled() {
+  s21::Array<int, 4> a{1, 2};
+  s21::Array<int, 4> b{};
+  b.fill(7);
+  a.swap(b);
+  s21::Array<int, 4> c = b;
+  c[3] = a.at(0) + c.front();
+  return c;
+}
+
+static_assert(swapped_and_filled()[1] == 2);
+static_assert(swapped_and_filled()[2] == 0);
+static_assert(swapped_and_filled().back() == 8);
+
+TEST_F(s21ArrayTest, CompileTimeTable) {
+  EXPECT_EQ(crc32(std::string("The quick brown fox jumps over the lazy dog")),
+            0x414FA339u);
+  s21::Array<uint32_t, 256> copy = crc32_table;
+  EXPECT_EQ(std::memcmp(copy.data(), crc32_table.data(), sizeof(copy)), 0);
+}
+
+TEST_F(s21ArrayTest, SwapNonTrivial) {
+  s21::Array<std::string, 3> a{"one", "two"};
+  s21::Array<std::string, 3> b{std::string(40, 'x')};
+  a.swap(b);
+  EXPECT_EQ(a[0], std::string(40, 'x'));
+  EXPECT_EQ(a[1], "");
+  EXPECT_EQ(b[1], "two");
+  EXPECT_EQ(b.back(), "");
+}
+
+/* ---------------------- ALIGNED ARRAY -------------------------- */
+
+static_assert(alignof(s21::aligned_array<float, 3, 32>) == 32);
+static_assert(s21::aligned_array<float, 3, 32>().padded_size() == 8);
+static_assert(s21::aligned_array<double, 8>().padded_size() == 8);
+static_assert(s21::aligned_array<char, 0>().padded_size() == 0);
+static_assert(s21::aligned_array<int, 5, 32>{1, 2, 3}.data()[7] == 0);
+static_assert(std::is_trivially_copyable_v<s21::aligned_array<int, 5>>);
+
+TEST(AlignedArrayTest, AlignedAndPadded) {
+  s21::aligned_array<float, 13, 32> a{1.0f, 2.0f};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) % 32, 0u);
+  EXPECT_EQ(a.size(), 13u);
+  EXPECT_EQ(a.padded_size(), 16u);
+  a.fill(3.0f);
+  EXPECT_EQ(std::count(a.begin(), a.end(), 3.0f), 13);
+  for (size_t i = a.size(); i < a.padded_size(); ++i)
+    EXPECT_EQ(a.data()[i], 0.0f);
+
+  s21::aligned_array<float, 13, 32> b;
+  EXPECT_EQ(b.front(), 0.0f);
+  b.at(12) = 5.0f;
+  a.swap(b);
+  EXPECT_EQ(a.back(), 5.0f);
+  EXPECT_EQ(b.back(), 3.0f);
+  EXPECT_THROW(b.at(13), std::out_of_range);
+  s21::aligned_array<float, 2, 32> too_short;
+  std::initializer_list<float> items = {1.0f, 2.0f, 3.0f};
+  EXPECT_THROW(too_short = items, std::out_of_range);
+}
+
+/* ---------------------------- DEQUE ----------------------------- */
+
+TEST(deque, BothEnds) {
+  s21::deque<std::string> s21_deque;
+  std::deque<std::string> std_deque;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 20000; ++i) {
+    switch (gen() % 6) {
+      case 0:
+      case 1:
+        s21_deque.push_back(std::to_string(i));
+        std_deque.push_back(std::to_string(i));
+        break;
+      case 2:
+        EXPECT_EQ(s21_deque.emplace_front(2, 'a' + i % 26),
+                  std_deque.emplace_front(2, 'a' + i % 26));
+        break;
+      case 3:
+        s21_deque.pop_back();
+        if (!std_deque.empty()) std_deque.pop_back();
+        break;
+      case 4:
+        s21_deque.pop_front();
+        if (!std_deque.empty()) std_deque.pop_front();
+        break;
+      default:
+        if (!std_deque.empty()) {
+          size_t pos = gen() % std_deque.size();
+          EXPECT_EQ(s21_deque[pos], std_deque[pos]);
+          EXPECT_EQ(s21_deque.front(), std_deque.front());
+          EXPECT_EQ(s21_deque.back(), std_deque.back());
+        }
+    }
+    ASSERT_EQ(s21_deque.size(), std_deque.size());
+  }
+  EXPECT_TRUE(std::equal(s21_deque.begin(), s21_deque.end(),
+                         std_deque.begin(), std_deque.end()));
+  EXPECT_THROW(s21_deque.at(s21_deque.size()), std::out_of_range);
+  s21_deque.clear();
+  EXPECT_TRUE(s21_deque.empty());
+  s21_deque.push_front("x");
+  EXPECT_EQ(s21_deque.at(0), "x");
+}
+
+TEST(deque, IteratorsAndCopies) {
+  s21::deque<int> s21_deque;
+  for (int i = 0; i < 1000; ++i) {
+    s21_deque.push_back(i * 7 % 1000);
+    s21_deque.push_front(-i);
+  }
+  std::sort(s21_deque.begin(), s21_deque.end());
+  EXPECT_TRUE(std::is_sorted(s21_deque.cbegin(), s21_deque.cend()));
+  EXPECT_EQ(s21_deque.end() - s21_deque.begin(), 2000);
+  EXPECT_EQ(*(s21_deque.begin() + 999), 0);
+  EXPECT_EQ(s21_deque.begin()[1999], 999);
+  s21::deque<int>::const_iterator it = s21_deque.begin();
+  EXPECT_TRUE(it < s21_deque.end());
+  const s21::deque<int> copy(s21_deque);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), s21_deque.begin()));
+  s21::deque<int> moved(std::move(s21_deque));
+  EXPECT_TRUE(s21_deque.empty());
+  EXPECT_EQ(moved.size(), copy.size());
+  s21_deque = copy;
+  EXPECT_EQ(s21_deque.back(), 999);
+  s21::deque<int> sized(5);
+  EXPECT_EQ(sized.size(), 5U);
+  EXPECT_EQ(sized[4], 0);
+}
+
 /* ---------------------------- QUEUE ----------------------------- */
 
 class S21QueueTest : public testing::Test {
@@ -1468,6 +2887,321 @@ TEST_F(S21QueueTest, EmplaceBack) {
   EXPECT_EQ(s21_queue_emplace.back(), std_queue_emplace.back());
 }
 
+TEST_F(S21QueueTest, AcrossBlocks) {
+  s21::Queue<std::string> s21_queue;
+  std::queue<std::string> std_queue;
+  for (int i = 0; i < 5000; ++i) {
+    std::string value = std::to_string(i);
+    s21_queue.push(std::move(value));
+    std_queue.push(std::to_string(i));
+    if (i % 3 == 0) {
+      EXPECT_EQ(s21_queue.front(), std_queue.front());
+      s21_queue.pop();
+      std_queue.pop();
+    }
+  }
+  s21::Queue<std::string> s21_copy(s21_queue);
+  EXPECT_EQ(s21_copy.size(), std_queue.size());
+  EXPECT_EQ(s21_copy.back(), std_queue.back());
+  while (!std_queue.empty()) {
+    EXPECT_EQ(s21_queue.front(), std_queue.front());
+    EXPECT_EQ(s21_copy.front(), std_queue.front());
+    s21_queue.pop();
+    s21_copy.pop();
+    std_queue.pop();
+  }
+  EXPECT_TRUE(s21_queue.empty());
+  s21_queue.emplace_back(3, 'x');
+  EXPECT_EQ(s21_queue.front(), "xxx");
+  EXPECT_EQ(s21_queue.back(), "xxx");
+}
+
+TEST_F(S21QueueTest, Backends) {
+  s21::Queue<std::string, std::list<std::string>> s21_list_queue;
+  s21::Queue<std::string, std::deque<std::string>> s21_std_deque_queue;
+  std::queue<std::string> std_queue;
+  for (int i = 0; i < 300; ++i) {
+    s21_list_queue.push(std::to_string(i));
+    s21_std_deque_queue.emplace_back(std::to_string(i));
+    std_queue.push(std::to_string(i));
+  }
+  while (!std_queue.empty()) {
+    EXPECT_EQ(s21_list_queue.front(), std_queue.front());
+    EXPECT_EQ(s21_std_deque_queue.front(), std_queue.front());
+    s21_list_queue.pop();
+    s21_std_deque_queue.pop();
+    std_queue.pop();
+  }
+  EXPECT_TRUE(s21_list_queue.empty());
+  EXPECT_TRUE(s21_std_deque_queue.empty());
+}
+
+/* ------------------------ SPSC QUEUE --------------------------- */
+
+TEST(spsc_queue, SingleThread) {
+  s21::spsc_queue<std::string> spsc(5);
+  EXPECT_EQ(spsc.capacity(), 8U);
+  EXPECT_THROW(s21::spsc_queue<int>{SIZE_MAX}, std::length_error);
+  EXPECT_TRUE(spsc.empty());
+  std::string value;
+  EXPECT_FALSE(spsc.try_pop(value));
+  for (int i = 0; i < 8; ++i) EXPECT_TRUE(spsc.try_push(std::to_string(i)));
+  EXPECT_FALSE(spsc.try_emplace(3, 'x'));
+  EXPECT_EQ(spsc.size(), 8U);
+  EXPECT_TRUE(spsc.try_pop(value));
+  EXPECT_EQ(value, "0");
+  EXPECT_TRUE(spsc.try_emplace(3, 'x'));
+  std::vector<std::string> out;
+  EXPECT_EQ(spsc.pop_n(std::back_inserter(out), 5), 5U);
+  EXPECT_EQ(out.front(), "1");
+  EXPECT_EQ(out.back(), "5");
+  std::vector<std::string> more{"a", "b", "c", "d", "e", "f", "g"};
+  EXPECT_EQ(spsc.push_n(more.begin(), more.size()), 5U);
+  EXPECT_EQ(spsc.pop_n(std::back_inserter(out), 100), 8U);
+  EXPECT_EQ(out[5], "6");
+  EXPECT_EQ(out[7], "xxx");
+  EXPECT_EQ(out.back(), "e");
+  EXPECT_TRUE(spsc.empty());
+  spsc.try_push("left for the destructor");
+}
+
+TEST(spsc_queue, PopNThrowingOutput) {
+  struct TakeTwo {
+    std::vector<std::string> *got;
+    TakeTwo &operator*() { return *this; }
+    TakeTwo &operator++() { return *this; }
+    TakeTwo &operator=(std::string &&value) {
+      if (got->size() == 2) throw 2;
+      got->push_back(std::move(value));
+      return *this;
+    }
+  };
+  s21::spsc_queue<std::string> spsc(4);
+  for (int i = 0; i < 4; ++i) spsc.try_push(std::string(32, 'a' + i));
+  std::vector<std::string> got;
+  EXPECT_THROW(spsc.pop_n(TakeTwo{&got}, 4), int);
+  EXPECT_EQ(got.size(), 2U);
+  EXPECT_EQ(spsc.size(), 2U);
+  std::string value;
+  EXPECT_TRUE(spsc.try_pop(value));
+  EXPECT_EQ(value, std::string(32, 'c'));
+}
+
+TEST(spsc_queue, ProducerConsumer) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<int> spsc(64);
+  std::thread producer{[&spsc] {
+    int batch[16];
+    for (int next = 0; next < kCount;) {
+      if (next % 3 == 0) {
+        if (spsc.try_push(next)) ++next;
+      } else {
+        int n = std::min(16, kCount - next);
+        for (int i = 0; i < n; ++i) batch[i] = next + i;
+        next += static_cast<int>(spsc.push_n(batch, n));
+      }
+      std::this_thread::yield();
+    }
+  }};
+  int expected = 0;
+  std::vector<int> out;
+  while (expected < kCount) {
+    out.clear();
+    int value;
+    if (expected % 2 && spsc.try_pop(value)) out.push_back(value);
+    spsc.pop_n(std::back_inserter(out), 32);
+    for (int got : out) EXPECT_EQ(got, expected++);
+    if (out.empty()) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(spsc.empty());
+}
+
+/* ------------------------ MPMC QUEUE --------------------------- */
+
+TEST(mpmc_queue, SingleThread) {
+  s21::mpmc_queue<std::string> mpmc(3);
+  EXPECT_EQ(mpmc.capacity(), 4U);
+  EXPECT_THROW(s21::mpmc_queue<int>{SIZE_MAX}, std::length_error);
+  std::string value;
+  EXPECT_FALSE(mpmc.try_pop(value));
+  EXPECT_TRUE(mpmc.try_push("a"));
+  EXPECT_TRUE(mpmc.try_emplace(2, 'b'));
+  mpmc.push(std::string{"c"});
+  EXPECT_TRUE(mpmc.try_push(value));
+  EXPECT_FALSE(mpmc.try_push("e"));
+  EXPECT_EQ(mpmc.size(), 4U);
+  mpmc.pop(value);
+  EXPECT_EQ(value, "a");
+  EXPECT_TRUE(mpmc.try_pop(value));
+  EXPECT_EQ(value, "bb");
+  for (int lap = 0; lap < 10; ++lap) {
+    EXPECT_TRUE(mpmc.try_push(std::to_string(lap)));
+    EXPECT_TRUE(mpmc.try_pop(value));
+  }
+  EXPECT_EQ(mpmc.size(), 2U);
+}
+
+TEST(mpmc_queue, ProducersConsumers) {
+  constexpr int kThreads = 4, kPerProducer = 20000;
+  s21::mpmc_queue<int> mpmc(16);
+  std::vector<std::thread> threads;
+  std::vector<std::vector<int>> received(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&mpmc, t] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        if (i % 2)
+          mpmc.push(t * kPerProducer + i);
+        else
+          while (!mpmc.try_push(t * kPerProducer + i))
+            std::this_thread::yield();
+      }
+    });
+    threads.emplace_back([&mpmc, &received, t] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        int value;
+        mpmc.pop(value);
+        received[t].push_back(value);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::vector<int> seen(kThreads * kPerProducer);
+  for (auto &values : received) {
+    std::vector<int> last(kThreads, -1);
+    for (int value : values) {
+      ++seen[value];
+      EXPECT_GT(value, last[value / kPerProducer]);
+      last[value / kPerProducer] = value;
+    }
+  }
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1),
+            kThreads * kPerProducer);
+  EXPECT_TRUE(mpmc.empty());
+}
+
+/* ---------------------- BLOCKING QUEUE ------------------------- */
+
+TEST(blocking_queue, SingleThread) {
+  s21::blocking_queue<std::string> queue(4);
+  std::string value;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_FALSE(queue.pop_for(value, std::chrono::milliseconds(1)));
+  std::vector<std::string> batch{"a", "b", "c"};
+  EXPECT_EQ(queue.push_bulk(batch.begin(), batch.end()), batch.end());
+  EXPECT_TRUE(queue.emplace(2, 'd'));
+  EXPECT_FALSE(queue.try_push("e"));
+  EXPECT_FALSE(queue.push_for("e", std::chrono::milliseconds(1)));
+  EXPECT_EQ(queue.size(), 4U);
+  std::vector<std::string> drained;
+  EXPECT_EQ(queue.drain(std::back_inserter(drained), 3), 3U);
+  EXPECT_EQ(drained, batch);
+  EXPECT_TRUE(queue.push("f"));
+  queue.close();
+  EXPECT_FALSE(queue.push("g"));
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, "dd");
+  EXPECT_EQ(queue.try_drain(std::back_inserter(drained), 8), 1U);
+  EXPECT_EQ(drained.back(), "f");
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_EQ(queue.drain(std::back_inserter(drained), 8), 0U);
+}
+
+TEST(blocking_queue, ProducersConsumers) {
+  constexpr int kThreads = 4, kPerProducer = 20000, kBatch = 64;
+  s21::blocking_queue<int> queue(100);
+  std::vector<std::thread> producers, consumers;
+  std::vector<std::vector<int>> received(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&queue, t] {
+      std::vector<int> batch;
+      for (int i = 0; i < kPerProducer; ++i) {
+        if (i % 3 == 0) {
+          queue.push(t * kPerProducer + i);
+          continue;
+        }
+        batch.push_back(t * kPerProducer + i);
+        if (batch.size() == kBatch || i + 1 == kPerProducer) {
+          queue.push_bulk(batch.begin(), batch.end());
+          batch.clear();
+        }
+      }
+    });
+    consumers.emplace_back([&queue, &received, t] {
+      int value;
+      if (t % 2)
+        while (queue.pop(value)) received[t].push_back(value);
+      else
+        while (queue.drain(std::back_inserter(received[t]), kBatch)) {
+        }
+    });
+  }
+  for (auto &thread : producers) thread.join();
+  queue.close();
+  for (auto &thread : consumers) thread.join();
+  std::vector<int> seen(kThreads * kPerProducer);
+  for (auto &values : received)
+    for (int value : values) ++seen[value];
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1),
+            kThreads * kPerProducer);
+  EXPECT_TRUE(queue.empty());
+}
+
+/* ---------------------- PRIORITY QUEUE ------------------------- */
+
+template <size_t Arity>
+void check_priority_queue_against_std() {
+  std::mt19937 gen(Arity);
+  std::vector<int> values(1000);
+  for (int &value : values) value = static_cast<int>(gen() % 500);
+  s21::priority_queue<int, s21::Vector<int>, std::less<int>, Arity> s21_pq(
+      values.begin(), values.begin() + 300);
+  std::priority_queue<int> std_pq(values.begin(), values.begin() + 300);
+  s21_pq.push_bulk(values.begin() + 300, values.begin() + 400);
+  for (auto it = values.begin() + 300; it != values.begin() + 400; ++it)
+    std_pq.push(*it);
+  for (size_t i = 400; i < values.size(); ++i) {
+    if (gen() % 3) {
+      s21_pq.push(values[i]);
+      std_pq.push(values[i]);
+    } else {
+      ASSERT_EQ(s21_pq.top(), std_pq.top());
+      s21_pq.pop();
+      std_pq.pop();
+    }
+  }
+  ASSERT_EQ(s21_pq.size(), std_pq.size());
+  for (; !std_pq.empty(); std_pq.pop(), s21_pq.pop())
+    ASSERT_EQ(s21_pq.top(), std_pq.top());
+  EXPECT_TRUE(s21_pq.empty());
+}
+
+TEST(priority_queue, AgainstStd) {
+  check_priority_queue_against_std<2>();
+  check_priority_queue_against_std<3>();
+  check_priority_queue_against_std<4>();
+  check_priority_queue_against_std<8>();
+}
+
+TEST(priority_queue, CompareAndMoves) {
+  s21::priority_queue<std::string, s21::Vector<std::string>,
+                      std::greater<std::string>>
+      pq{"pear", "apple", "fig"};
+  EXPECT_EQ(pq.top(), "apple");
+  pq.emplace(3, 'a');
+  std::vector<std::string> more{"kiwi", "banana", "lime", "date"};
+  pq.push_bulk(more.begin(), more.end());
+  std::vector<std::string> order;
+  for (; !pq.empty(); pq.pop()) order.push_back(pq.top());
+  EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+  EXPECT_EQ(order.front(), "aaa");
+  EXPECT_EQ(order.size(), 8U);
+  pq.pop();
+  s21::Vector<std::string> heap{"b", "c", "a"};
+  s21::priority_queue<std::string> from_container(std::move(heap));
+  EXPECT_EQ(from_container.top(), "c");
+}
+
 /* ------------------------ STACK ------------------------------ */
 
 class S21StackTest : public testing::Test {
@@ -1649,6 +3383,96 @@ TEST_F(S21StackTest, EmplaceFront) {
   EXPECT_EQ(s21_stack_emplace.top(), std_stack_emplace.top());
 }
 
+TEST_F(S21StackTest, Backends) {
+  s21::Stack<std::string> s21_vector_stack;
+  s21::Stack<std::string, std::list<std::string>> s21_list_stack;
+  s21::Stack<std::string, s21::deque<std::string>> s21_deque_stack;
+  std::stack<std::string> std_stack;
+  s21_vector_stack.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    std::string value = std::to_string(i);
+    s21_list_stack.push(value);
+    s21_deque_stack.push(value);
+    s21_vector_stack.push(std::move(value));
+    std_stack.push(std::to_string(i));
+  }
+  EXPECT_EQ(s21_vector_stack.emplace(3, 'x'), "xxx");
+  s21_list_stack.emplace(3, 'x');
+  s21_deque_stack.emplace(3, 'x');
+  std_stack.emplace(3, 'x');
+  s21::Stack<std::string> s21_copy(s21_vector_stack);
+  EXPECT_EQ(s21_copy.size(), std_stack.size());
+  while (!std_stack.empty()) {
+    EXPECT_EQ(s21_vector_stack.top(), std_stack.top());
+    EXPECT_EQ(s21_list_stack.top(), std_stack.top());
+    EXPECT_EQ(s21_deque_stack.top(), std_stack.top());
+    EXPECT_EQ(s21_copy.top(), std_stack.top());
+    s21_vector_stack.pop();
+    s21_list_stack.pop();
+    s21_deque_stack.pop();
+    s21_copy.pop();
+    std_stack.pop();
+  }
+  EXPECT_TRUE(s21_vector_stack.empty());
+  EXPECT_TRUE(s21_list_stack.empty());
+}
+
+/* ---------------------- WORK-STEALING DEQUE --------------------- */
+
+TEST(ws_deque, OwnerAndThief) {
+  s21::ws_deque<int> deque(2);
+  int value;
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_FALSE(deque.steal(value));
+  for (int i = 0; i < 100; ++i) deque.push(i);
+  EXPECT_EQ(deque.capacity(), 128U);
+  EXPECT_EQ(deque.size(), 100U);
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 99);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+  for (int i = 98; i >= 2; --i) {
+    EXPECT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(ws_deque, ConcurrentSteal) {
+  constexpr int kCount = 100000, kThieves = 3;
+  s21::ws_deque<int> deque(4);
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(kThieves);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t)
+    thieves.emplace_back([&deque, &done, &stolen, t] {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value))
+          stolen[t].push_back(value);
+        else
+          std::this_thread::yield();
+      }
+    });
+  std::vector<int> popped;
+  int value;
+  for (int i = 0; i < kCount; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) popped.push_back(value);
+  }
+  while (deque.pop(value)) popped.push_back(value);
+  done = true;
+  for (auto &thief : thieves) thief.join();
+  std::vector<int> seen(kCount);
+  for (int got : popped) ++seen[got];
+  for (auto &values : stolen)
+    for (int got : values) ++seen[got];
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), kCount);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
 #ifdef __APPLE__